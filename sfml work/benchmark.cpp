@@ -0,0 +1,880 @@
+// ===================================================================================
+// FILE: benchmark.cpp
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: A headless benchmark for the pathfinding algorithms. It builds a
+// large open grid, runs BFS, DFS, A*, Dijkstra, JPS, JPS+ and the two bidirectional
+// searches to completion with the live path redraw turned off, and prints how many
+// algorithm steps each one manages per second. A second map with random walls
+// compares the nodes JPS, JPS+ and the bidirectional searches visit against A*,
+// BFS and Dijkstra, with and without diagonals, and A*'s heuristics against each
+// other on 8-connected grids (where a diagonal step costs 141 hundredths). It times
+// carving a 4096x4096 DFS maze and checks that a seed always gives the same one, then
+// every maze generator (DFS, Kruskal, Prim, Wilson, recursive division, Eller) on a
+// 1024x1024 grid, with the peak memory of each per cell. On a DFS maze it times building the ALT landmark tables and the searches they save, and
+// keeping the region index up to date as walls are toggled; on a map cut in two it
+// compares BFS's "no path" with the index's instant answer. It then times an LPA*
+// repair after a few walls are dropped onto its path against a search from scratch,
+// and HPA*'s abstract and concrete expansions against A* (with the cost of a lazy
+// rebuild). A weighted map times Dijkstra and A* with each open set
+// structure (binary heap, indexed 4-ary heap, bucket queue, radix heap), whose path
+// costs must all agree, and prints each one's peak size and operation counts.
+// On 4096x4096 maps it times the bitboard BFS, with and without AVX2, against BFS,
+// and the parallel BFS's full distance field on 1, 2, 4 ... threads up to one per core.
+// A 2048x2048 weighted map times delta-stepping against Dijkstra, over several bucket
+// widths and then over the same thread counts.
+// It fills a 64x64 distance matrix between random cells of the walled map (BFS
+// 4-connected, Dijkstra 8-connected) on the same thread counts, checking one entry
+// against a single Dijkstra run. A flow field towards the walled map's end is timed
+// against one A* search per agent for 200 agents, whose costs must agree, and its
+// incremental update after a few wall edits against a rebuild. It compares an A*
+// search on the walled map with replaying the same query from the result cache,
+// and checks that a wall edit makes the query miss. Finally it fires
+// many short A* searches at the same map with one reused state, which measures the
+// per-run setup and clearPath() overhead.
+// Given a Moving AI scenario file instead, it loads the map the scenarios are on,
+// runs every query through the searches on 8-connected moves and checks the path
+// costs of A*, Dijkstra and delta-stepping against the file's optimal lengths. It
+// only depends on the render-free GridModel, so SFML is not needed:
+//
+//   g++ -std=c++17 -O2 benchmark.cpp src/GridModel.cpp src/LivePath.cpp src/BFS.cpp src/DFS.cpp
+//       src/Astar.cpp src/Dijkstra.cpp src/JPS.cpp src/Bidirectional.cpp
+//       src/LPAStar.cpp src/HPA.cpp src/MonotoneQueue.cpp src/Landmarks.cpp
+//       src/MazeGenerator.cpp src/BitBFS.cpp src/WorkerPool.cpp src/ParallelBFS.cpp
+//       src/DeltaStepping.cpp src/Connectivity.cpp src/MovingAI.cpp src/ResultCache.cpp
+//       src/DistanceMatrix.cpp src/FlowField.cpp -pthread -o benchmark
+//   ./benchmark [size]        (size x size grid, default 1000)
+//   ./benchmark --scen <file.scen> [file.map]   (the map defaults to the one named in
+//                                                the scenarios, next to the .scen file)
+// ===================================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+#include "src/GridModel.h"
+#include "src/BFS.h"
+#include "src/BitBFS.h"
+#include "src/ParallelBFS.h"
+#include "src/DeltaStepping.h"
+#include "src/DFS.h"
+#include "src/Astar.h"
+#include "src/Dijkstra.h"
+#include "src/JPS.h"
+#include "src/Bidirectional.h"
+#include "src/LPAStar.h"
+#include "src/HPA.h"
+#include "src/MazeGenerator.h"
+#include "src/Connectivity.h"
+#include "src/MovingAI.h"
+#include "src/ResultCache.h"
+#include "src/DistanceMatrix.h"
+#include "src/FlowField.h"
+#include <string>
+
+struct BenchResult {
+    long long steps = 0;
+    double seconds = 0.0;
+    int nodesVisited = 0;
+    int pathCost = 0;
+};
+
+/**
+ * @brief Runs one algorithm from a clean path state until it completes.
+ * @param grid The grid to search (its search markers are cleared first).
+ * @param start A callable that seeds the state with the grid's start cell.
+ * @param step A callable that performs a single algorithm step.
+ * @param isDiagonal Whether diagonal moves are allowed.
+ * @param state The state to run with, so precomputed data can be prepared untimed.
+ */
+template <typename State, typename StartFn, typename StepFn>
+BenchResult runToCompletion(GridModel& grid, StartFn start, StepFn step, bool isDiagonal = false,
+                            State state = State()) {
+    grid.clearPath();
+    state.drawLivePath = false;
+    start(grid, state);
+
+    BenchResult result;
+    auto begin = std::chrono::steady_clock::now();
+    while (!state.isComplete) {
+        step(grid, state, isDiagonal);
+        result.steps++;
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    result.seconds = std::chrono::duration<double>(end - begin).count();
+    result.nodesVisited = state.nodesVisited;
+    result.pathCost = state.pathCost;
+    return result;
+}
+
+// The weighted searches pick their movement model when they start, so they take the
+// connectivity there; these fit the two-argument start runToCompletion calls.
+void startAStar4(GridModel& grid, AStarState& state) { startAStar(grid, state, false); }
+void startAStar8(GridModel& grid, AStarState& state) { startAStar(grid, state, true); }
+void startDijkstra4(GridModel& grid, DijkstraState& state) { startDijkstra(grid, state, false); }
+void startDijkstra8(GridModel& grid, DijkstraState& state) { startDijkstra(grid, state, true); }
+void startJPS4(GridModel& grid, JPSState& state) { startJPS(grid, state, false); }
+void startJPS8(GridModel& grid, JPSState& state) { startJPS(grid, state, true); }
+void startBiAStar4(GridModel& grid, BidirectionalAStarState& state) { startBidirectionalAStar(grid, state, false); }
+void startBiAStar8(GridModel& grid, BidirectionalAStarState& state) { startBidirectionalAStar(grid, state, true); }
+
+/**
+ * @brief Runs many short A* searches on the same map, reusing one state object.
+ *
+ * Each search clears the previous path and starts a fresh run, exactly like
+ * pressing "Start" again in the visualizer, so the time is dominated by the
+ * per-run setup rather than by the search itself.
+ * @return The number of searches completed per second.
+ */
+double repeatedSearchesPerSecond(GridModel& grid, int searches) {
+    AStarState state;
+    state.drawLivePath = false;
+
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < searches; ++i) {
+        grid.clearPath();
+        startAStar(grid, state, false);
+        while (!state.isComplete) aStarStep(grid, state, false);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - begin).count();
+    return seconds > 0.0 ? searches / seconds : 0.0;
+}
+
+// 1, 2, 4 ... workers, ending on exactly one per core.
+std::vector<int> threadCounts() {
+    std::vector<int> counts;
+    for (int threads = 1; threads < WorkerPool::hardwareWorkers(); threads *= 2) counts.push_back(threads);
+    counts.push_back(WorkerPool::hardwareWorkers());
+    return counts;
+}
+
+void printResult(const char* name, const BenchResult& r) {
+    double stepsPerSecond = r.seconds > 0.0 ? r.steps / r.seconds : 0.0;
+    std::printf("%-10s %10lld steps %9.3f s %12.0f steps/s   visited %8d   cost %6d\n",
+                name, r.steps, r.seconds, stepsPerSecond, r.nodesVisited, r.pathCost);
+}
+
+void printQueueStats(const char* name, const QueueStats& stats) {
+    std::printf("%-10s open set peak %8zu   pushes %8lld   pops %8lld   decrease-keys %8lld\n",
+                name, stats.peakSize, stats.pushes, stats.pops, stats.decreaseKeys);
+}
+
+// A JPS state that paints nothing, with its wall data (packed rows for JPS, the
+// jump distance table for JPS+) already built so it is not part of the timing.
+JPSState headlessJPS(const GridModel& grid, bool isDiagonal, bool buildTable) {
+    JPSState state;
+    state.paintScans = false;
+    if (buildTable) {
+        buildJumpDistances(grid, state, isDiagonal);
+    } else {
+        packWalls(grid, state);
+    }
+    return state;
+}
+
+// Prints one algorithm's line of the scenario report; returns true if it failed.
+bool printScenarioReport(const char* name, const ScenarioReport& r) {
+    double mean = r.queries > 0 ? r.totalSeconds / r.queries : 0.0;
+    bool failed = scenarioFailed(r);
+    std::printf("%-10s %6d queries  %9.1f us/query (worst %9.1f us)   matched %6d  shorter %6d  longer %4d"
+                "  unsolved %4d  unchecked %6d   max error %.1e%s\n",
+                name, r.queries, mean * 1e6, r.worstSeconds * 1e6, r.matched, r.shorter, r.longer, r.unsolved,
+                r.unchecked, r.worstError, failed ? "   FAILED" : "");
+    return failed;
+}
+
+// The exact length of the path a finished search returned, for the searches that
+// can keep diagonals off wall corners. The others are only timed: BFS ignores
+// weights, JPS's pruning rules assume corners can be cut, and HPA*'s paths are only
+// near-optimal by design.
+double parentPathLength(const GridModel& grid, const std::vector<int>& parent) {
+    std::vector<int> path;
+    for (int cell = grid.endIndex; cell != -1; cell = parent[cell]) path.push_back(cell);
+    std::reverse(path.begin(), path.end());
+    return octileLength(grid, path);
+}
+double aStarLength(const GridModel& grid, const AStarState& state) { return parentPathLength(grid, state.parent); }
+double dijkstraLength(const GridModel& grid, const DijkstraState& state) { return parentPathLength(grid, state.parent); }
+double deltaLength(const GridModel& grid, const DeltaSteppingState& state) { return octileLength(grid, state.path); }
+double biAStarLength(const GridModel& grid, const BidirectionalAStarState& state) { return octileLength(grid, state.chain); }
+template <typename State>
+double notChecked(const GridModel&, const State&) { return -1.0; }
+
+/**
+ * @brief Runs a Moving AI scenario file through the searches (8-connected, no
+ * corner cutting).
+ * @return The exit code: 0, 1 if a file could not be loaded, or 2 if a checked
+ * search missed an optimal length.
+ */
+int runScenarioFile(const std::string& scenPath, std::string mapPath) {
+    std::string error;
+    std::vector<MovingAIScenario> scenarios;
+    if (!loadMovingAIScenarios(scenPath, scenarios, error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    if (scenarios.empty()) {
+        std::fprintf(stderr, "%s: no queries\n", scenPath.c_str());
+        return 1;
+    }
+    if (mapPath.empty()) {
+        // Scenario files name their map with a relative path; look for its file name
+        // next to the scenario file.
+        std::string name = scenarios[0].map.substr(scenarios[0].map.find_last_of("/\\") + 1);
+        std::size_t slash = scenPath.find_last_of("/\\");
+        mapPath = (slash == std::string::npos ? std::string() : scenPath.substr(0, slash + 1)) + name;
+    }
+
+    GridModel grid(1, 1);
+    auto begin = std::chrono::steady_clock::now();
+    if (!loadMovingAIMap(mapPath, grid, error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    double loadSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    int walls = 0;
+    for (NodeType type : grid.types) walls += type == NodeType::Wall;
+    std::printf("%s: %dx%d, %d walls, loaded in %.2f ms; %zu queries from %s (8-connected)\n", mapPath.c_str(),
+                grid.cols, grid.rows, walls, loadSeconds * 1000, scenarios.size(), scenPath.c_str());
+
+    AStarState aStar;
+    aStar.drawLivePath = false;
+    DijkstraState dijkstra;
+    dijkstra.drawLivePath = false;
+    DeltaSteppingState delta;
+    delta.paintCells = false;
+    delta.threads = 1;
+    BFSState bfs;
+    bfs.drawLivePath = false;
+    BidirectionalAStarState biAStar;
+    biAStar.drawLivePath = false;
+    HPAState hpa;
+    hpa.drawLivePath = false;
+    JPSState jps = headlessJPS(grid, true, false);
+    JPSState jpsPlus = headlessJPS(grid, true, true);
+    bool failed = false;
+    failed |= printScenarioReport("A*", runScenarios(grid, scenarios, [](GridModel& g, AStarState& st, bool cut) {
+        startAStar(g, st, true, cut);
+    }, aStarStep, aStarLength, true, aStar));
+    failed |= printScenarioReport("Dijkstra", runScenarios(grid, scenarios, [](GridModel& g, DijkstraState& st, bool cut) {
+        startDijkstra(g, st, true, cut);
+    }, dijkstraStep, dijkstraLength, true, dijkstra));
+    failed |= printScenarioReport("Delta", runScenarios(grid, scenarios, [](GridModel& g, DeltaSteppingState& st, bool cut) {
+        startDeltaStepping(g, st, true, cut);
+    }, deltaSteppingStep, deltaLength, true, delta));
+    failed |= printScenarioReport("BiA*", runScenarios(grid, scenarios, [](GridModel& g, BidirectionalAStarState& st, bool cut) {
+        startBidirectionalAStar(g, st, true, cut);
+    }, bidirectionalAStarStep, biAStarLength, true, biAStar));
+    failed |= printScenarioReport("JPS", runScenarios(grid, scenarios, [](GridModel& g, JPSState& st, bool) {
+        startJPS(g, st, true);
+    }, jpsStep, notChecked<JPSState>, true, jps));
+    failed |= printScenarioReport("JPS+", runScenarios(grid, scenarios, [](GridModel& g, JPSState& st, bool) {
+        startJPS(g, st, true);
+    }, jpsPlusStep, notChecked<JPSState>, true, jpsPlus));
+    failed |= printScenarioReport("HPA*", runScenarios(grid, scenarios, [](GridModel& g, HPAState& st, bool) {
+        startHPA(g, st, true);
+    }, hpaStep, notChecked<HPAState>, true, hpa));
+    failed |= printScenarioReport("BFS", runScenarios(grid, scenarios, [](GridModel& g, BFSState& st, bool) {
+        startBFS(g, st);
+    }, bfsStep, notChecked<BFSState>, true, bfs));
+    return failed ? 2 : 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 2 && std::string(argv[1]) == "--scen") return runScenarioFile(argv[2], argc > 3 ? argv[3] : "");
+
+    int size = argc > 1 ? std::atoi(argv[1]) : 1000;
+    if (size < 2) size = 2;
+
+    // A large open grid: start in the top-left corner, end in the bottom-right one.
+    GridModel grid(size, size);
+    grid.setType(grid.index(0, 0), NodeType::Start);
+    grid.setType(grid.index(size - 1, size - 1), NodeType::End);
+
+    std::printf("Open grid %dx%d (%d cells)\n", size, size, grid.size());
+    printResult("BFS", runToCompletion<BFSState>(grid, startBFS, bfsStep));
+    printResult("DFS", runToCompletion<DFSState>(grid, startDFS, dfsStep));
+    printResult("A*", runToCompletion<AStarState>(grid, startAStar4, aStarStep));
+    printResult("Dijkstra", runToCompletion<DijkstraState>(grid, startDijkstra4, dijkstraStep));
+    printResult("JPS", runToCompletion<JPSState>(grid, startJPS4, jpsStep, false, headlessJPS(grid, false, false)));
+    printResult("JPS+", runToCompletion<JPSState>(grid, startJPS4, jpsPlusStep, false, headlessJPS(grid, false, true)));
+    printResult("BiBFS", runToCompletion<BidirectionalBFSState>(grid, startBidirectionalBFS, bidirectionalBFSStep));
+    printResult("BiA*", runToCompletion<BidirectionalAStarState>(grid, startBiAStar4, bidirectionalAStarStep));
+
+    // A map with 20% random walls (fixed seed) for the JPS / A* comparison.
+    GridModel walled(size, size);
+    std::srand(42);
+    for (int i = 0; i < walled.size(); ++i) {
+        // Keep the corners open so the start and end cannot be walled in.
+        bool nearCorner = (walled.rowOf(i) < 3 && walled.colOf(i) < 3) ||
+                          (walled.rowOf(i) >= size - 3 && walled.colOf(i) >= size - 3);
+        if (!nearCorner && std::rand() % 5 == 0) walled.setType(i, NodeType::Wall);
+    }
+    walled.setType(walled.index(0, 0), NodeType::Start);
+    walled.setType(walled.index(size - 1, size - 1), NodeType::End);
+
+    for (int diagonal = 0; diagonal < 2; ++diagonal) {
+        std::printf("\n20%% random walls, %s\n", diagonal ? "8-connected" : "4-connected");
+
+        auto begin = std::chrono::steady_clock::now();
+        JPSState prepared = headlessJPS(walled, diagonal, true);
+        double precompute = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        std::printf("JPS+ jump distance table built in %.3f s\n", precompute);
+
+        printResult("A*", runToCompletion<AStarState>(walled, diagonal ? startAStar8 : startAStar4, aStarStep, diagonal));
+        printResult("JPS", runToCompletion<JPSState>(walled, diagonal ? startJPS8 : startJPS4, jpsStep, diagonal, headlessJPS(walled, diagonal, false)));
+        printResult("JPS+", runToCompletion<JPSState>(walled, diagonal ? startJPS8 : startJPS4, jpsPlusStep, diagonal, prepared));
+        printResult("BFS", runToCompletion<BFSState>(walled, startBFS, bfsStep, diagonal));
+        printResult("BiBFS", runToCompletion<BidirectionalBFSState>(walled, startBidirectionalBFS, bidirectionalBFSStep, diagonal));
+        printResult("Dijkstra", runToCompletion<DijkstraState>(walled, diagonal ? startDijkstra8 : startDijkstra4, dijkstraStep, diagonal));
+        printResult("BiA*", runToCompletion<BidirectionalAStarState>(walled, diagonal ? startBiAStar8 : startBiAStar4, bidirectionalAStarStep, diagonal));
+    }
+
+    // Heuristics for 8-connected A*: the old Manhattan estimate against the ones that
+    // match diagonal moves, on the open grid and on the walled map.
+    {
+        const HeuristicKind kinds[] = {HeuristicKind::Manhattan, HeuristicKind::Octile, HeuristicKind::Chebyshev,
+                                       HeuristicKind::Euclidean};
+        GridModel* maps[] = {&grid, &walled};
+        for (int m = 0; m < 2; ++m) {
+            std::printf("\nA* heuristics, %s (8-connected, costs in hundredths)\n", m == 0 ? "open grid" : "20% random walls");
+            for (HeuristicKind kind : kinds) {
+                AStarState aStar;
+                aStar.heuristic = kind;
+                printResult(heuristicName(kind), runToCompletion<AStarState>(*maps[m], startAStar8, aStarStep, true, aStar));
+            }
+        }
+    }
+
+    // Maze generation on a 4096x4096 grid, whatever the size argument: carving alone
+    // (the grid is filled with walls beforehand), then the same seed again, which must
+    // carve exactly the same maze.
+    {
+        const int mazeSize = 4096;
+        GridModel maze(mazeSize, mazeSize);
+        maze.fillWithWalls();
+        MazeGeneratorState carver;
+        auto begin = std::chrono::steady_clock::now();
+        startMaze(maze, carver, 0, 2024);
+        long long steps = 0;
+        for (; carver.isGenerating; ++steps) mazeStep(maze, carver);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        std::vector<NodeType> first = maze.types;
+
+        maze.fillWithWalls();
+        startMaze(maze, carver, 0, 2024);
+        while (carver.isGenerating) mazeStep(maze, carver);
+        bool repeated = maze.types == first;
+        maze.fillWithWalls();
+        startMaze(maze, carver, 0, 2025);
+        while (carver.isGenerating) mazeStep(maze, carver);
+        bool differs = maze.types != first;
+
+        std::printf("\nDFS maze, %dx%d\n", mazeSize, mazeSize);
+        std::printf("Carved in %.3f s (%lld steps, %.1f M steps/s), stack capacity %zu cells\n", seconds, steps,
+                    seconds > 0.0 ? steps / seconds / 1e6 : 0.0, carver.stack.capacity());
+        std::printf("Same seed, same maze: %s   next seed, another maze: %s\n", repeated ? "yes" : "NO",
+                    differs ? "yes" : "NO");
+    }
+
+    // Every maze generator on a 1024x1024 grid: time, steps, and the peak size of its
+    // own arrays per grid cell (the grid itself is not counted). A perfect maze opens
+    // every maze cell and exactly one passage fewer than there are cells.
+    {
+        const int mazeSize = 1024;
+        GridModel maze(mazeSize, mazeSize);
+        int mazeCells = (mazeSize + 1) / 2 * ((mazeSize + 1) / 2);
+        std::printf("\nMaze generators, %dx%d\n", mazeSize, mazeSize);
+        for (int k = 0; k < MAZE_KIND_COUNT; ++k) {
+            maze.fillWithWalls();
+            MazeGeneratorState generator;
+            generator.kind = static_cast<MazeKind>(k);
+            auto begin = std::chrono::steady_clock::now();
+            startMaze(maze, generator, 0, 7);
+            long long steps = 0;
+            for (; generator.isGenerating; ++steps) mazeStep(maze, generator);
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+            int open = 0;
+            for (int i = 0; i < maze.size(); ++i) open += maze.types[i] != NodeType::Wall;
+            std::size_t bytes = mazeGeneratorBytes(generator);
+            std::printf("%-9s %8.3f s   %9lld steps   peak %9.1f KB, %6.3f bytes/cell%s\n", mazeKindName(generator.kind),
+                        seconds, steps, bytes / 1024.0, static_cast<double>(bytes) / maze.size(),
+                        open == 2 * mazeCells - 1 ? "" : "   NOT A PERFECT MAZE");
+        }
+    }
+
+    // ALT on a DFS maze, where Manhattan badly underestimates: build the landmark
+    // tables once, answer a batch of random queries with them, then edit one wall
+    // so the next search has to rebuild them.
+    {
+        GridModel maze(size, size);
+        maze.fillWithWalls();
+        MazeGeneratorState carver;
+        startMaze(maze, carver, 0, 1);
+        while (carver.isGenerating) mazeStep(maze, carver);
+
+        std::vector<int> open;
+        for (int i = 0; i < maze.size(); ++i) {
+            if (maze.types[i] == NodeType::Empty) open.push_back(i);
+        }
+        const int queries = 20;
+        std::printf("\nALT on a DFS maze (4-connected, %d random queries)\n", queries);
+        AStarState alt;
+        alt.drawLivePath = false;
+        alt.heuristic = HeuristicKind::Landmarks;
+        auto begin = std::chrono::steady_clock::now();
+        buildLandmarks(maze, alt.landmarks, false);
+        std::printf("%d landmarks built in %.3f s, tables %.1f MB (%s entries)\n", static_cast<int>(alt.landmarks.cells.size()),
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count(),
+                    alt.landmarks.bytes / (1024.0 * 1024.0), alt.landmarks.isWide ? "32-bit" : "16-bit");
+
+        std::srand(11);
+        BenchResult manhattan, landmarks;
+        for (int q = 0; q < queries; ++q) {
+            maze.clearPath();
+            if (maze.startIndex >= 0) maze.setType(maze.startIndex, NodeType::Empty);
+            if (maze.endIndex >= 0) maze.setType(maze.endIndex, NodeType::Empty);
+            maze.setType(open[std::rand() % open.size()], NodeType::Start);
+            int end;
+            do end = open[std::rand() % open.size()]; while (end == maze.startIndex);
+            maze.setType(end, NodeType::End);
+
+            BenchResult m = runToCompletion<AStarState>(maze, startAStar4, aStarStep);
+            BenchResult l = runToCompletion<AStarState>(maze, startAStar4, aStarStep, false, alt);
+            manhattan.seconds += m.seconds;
+            manhattan.nodesVisited += m.nodesVisited;
+            landmarks.seconds += l.seconds;
+            landmarks.nodesVisited += l.nodesVisited;
+            if (m.pathCost != l.pathCost) std::printf("query %d: costs differ (%d vs %d)\n", q, m.pathCost, l.pathCost);
+        }
+        std::printf("Manhattan  %9.3f s   visited %10d\n", manhattan.seconds, manhattan.nodesVisited);
+        std::printf("ALT        %9.3f s   visited %10d\n", landmarks.seconds, landmarks.nodesVisited);
+
+        // Knocking out a wall is an edit, so the next ALT search rebuilds the tables.
+        maze.clearPath();
+        for (int i = 0; i < maze.size(); ++i) {
+            if (maze.types[i] == NodeType::Wall) {
+                maze.setType(i, NodeType::Empty);
+                break;
+            }
+        }
+        begin = std::chrono::steady_clock::now();
+        startAStar(maze, alt, false);
+        std::printf("after 1 edit: tables %s in %.3f s\n", alt.landmarksRebuilt ? "rebuilt" : "kept",
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count());
+
+        // The region index on the same maze: a full labelling, then random walls
+        // toggled one at a time with a query after each, which replays just that edit.
+        std::printf("\nConnectivity index on the DFS maze (4-connected)\n");
+        ConnectivityIndex regions;
+        begin = std::chrono::steady_clock::now();
+        syncConnectivity(maze, regions, false);
+        std::printf("built in %.3f s, %d regions\n",
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count(), regions.regions);
+        const int toggles = 2000;
+        int connectedPairs = 0;
+        begin = std::chrono::steady_clock::now();
+        for (int t = 0; t < toggles; ++t) {
+            int cell = std::rand() % maze.size();
+            maze.setType(cell, maze.types[cell] == NodeType::Wall ? NodeType::Empty : NodeType::Wall);
+            connectedPairs += cellsConnected(maze, regions, open[std::rand() % open.size()],
+                                             open[std::rand() % open.size()], false);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        std::printf("%d toggles + queries in %.3f s (%.1f us each): %d split searches, %d splits, %lld cells searched, "
+                    "%d full builds, %d of %d pairs connected\n",
+                    toggles, seconds, seconds * 1e6 / toggles, regions.splitSearches, regions.splits,
+                    regions.cellsSearched, regions.fullBuilds, connectedPairs, toggles);
+    }
+
+    // "No path" on a map split in two by a wall: BFS floods the start's half before it
+    // gives up, while the region index answers at once.
+    {
+        GridModel split(size, size);
+        for (int r = 0; r < size; ++r) split.setType(split.index(r, size / 2), NodeType::Wall);
+        split.setType(split.index(0, 0), NodeType::Start);
+        split.setType(split.index(size - 1, size - 1), NodeType::End);
+        std::printf("\nNo path across a wall splitting the map (4-connected)\n");
+        printResult("BFS", runToCompletion<BFSState>(split, startBFS, bfsStep));
+        ConnectivityIndex regions;
+        syncConnectivity(split, regions, false);
+        auto begin = std::chrono::steady_clock::now();
+        bool connected = cellsConnected(split, regions, split.startIndex, split.endIndex, false);
+        std::printf("Index      answered \"%s\" in %.6f s\n", connected ? "connected" : "different regions",
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count());
+    }
+
+    // LPA*: search the walled map, block its path in a few places, then repair it.
+    {
+        std::printf("\nLPA* repair after 10 walls are placed on the path (4-connected)\n");
+        walled.clearPath();
+        LPAState lpa;
+        lpa.drawLivePath = false;
+        startLPA(walled, lpa, false);
+        auto begin = std::chrono::steady_clock::now();
+        while (!lpa.isComplete) lpaStep(walled, lpa, false);
+        double first = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        std::printf("first search   %9.3f s   touched %8d   cost %6d\n", first, lpa.nodesTouched, lpa.pathCost);
+
+        for (int i = 1; i <= 10; ++i) {
+            walled.setType(lpa.chain[i * lpa.chain.size() / 11], NodeType::Wall);
+        }
+        walled.clearPath();
+        begin = std::chrono::steady_clock::now();
+        lpaApplyEdits(walled, lpa, false);
+        while (!lpa.isComplete) lpaStep(walled, lpa, false);
+        double repair = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        std::printf("repair         %9.3f s   touched %8d   cost %6d\n", repair, lpa.nodesTouched, lpa.pathCost);
+
+        begin = std::chrono::steady_clock::now();
+        LPAComparison comparison;
+        int full = lpaFullReplanTouched(walled, false, comparison);
+        double replan = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        std::printf("full replan    %9.3f s   touched %8d\n", replan, full);
+    }
+
+    // HPA*: build the cluster graph once, search it, then edit a few cells and search
+    // again, which only rebuilds the clusters around the edits.
+    {
+        std::printf("\nHPA* on the walled map (4-connected, %d-cell clusters)\n", HPAState().clusterSize);
+        walled.clearPath();
+        HPAState hpa;
+        hpa.drawLivePath = false;
+        auto begin = std::chrono::steady_clock::now();
+        buildClusters(walled, hpa, false);
+        double build = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        std::printf("cluster graph built in %.3f s (%zu clusters)\n", build, hpa.clusters.size());
+
+        for (int pass = 0; pass < 2; ++pass) {
+            if (pass == 1) {
+                for (int i = 1; i <= 10; ++i) walled.setType(walled.index(i * size / 11, i * size / 11), NodeType::Wall);
+                walled.clearPath();
+            }
+            begin = std::chrono::steady_clock::now();
+            startHPA(walled, hpa, false);
+            while (!hpa.isComplete) hpaStep(walled, hpa, false);
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+            std::printf("%s %9.3f s   abstract %6d   concrete %7d   cost %6d   clusters rebuilt %d\n",
+                        pass == 0 ? "search        " : "after 10 edits", seconds, hpa.abstractExpanded,
+                        hpa.concreteExpanded, hpa.pathCost, hpa.clustersRebuilt);
+            walled.clearPath();
+        }
+        printResult("A*", runToCompletion<AStarState>(walled, startAStar4, aStarStep));
+    }
+
+    // Open set structures: a map with 20% walls and 30% weights, so costs vary a lot.
+    {
+        GridModel weighted(size, size);
+        std::srand(7);
+        for (int i = 0; i < weighted.size(); ++i) {
+            int r = std::rand() % 10;
+            if (r < 2) weighted.setType(i, NodeType::Wall);
+            else if (r < 5) weighted.setType(i, NodeType::Weight);
+        }
+        weighted.setType(weighted.index(0, 0), NodeType::Start);
+        weighted.setType(weighted.index(size - 1, size - 1), NodeType::End);
+
+        std::printf("\nOpen set structures, 20%% walls and 30%% weights (4-connected)\n");
+        const QueueKind kinds[] = {QueueKind::BinaryHeap, QueueKind::QuaternaryHeap, QueueKind::Bucket, QueueKind::Radix};
+        for (QueueKind kind : kinds) {
+            DijkstraState dijkstra;
+            dijkstra.queueKind = kind;
+            AStarState aStar;
+            aStar.queueKind = kind;
+            std::printf("%s\n", queueKindName(kind));
+            printResult("Dijkstra", runToCompletion<DijkstraState>(weighted, startDijkstra4, dijkstraStep, false, dijkstra));
+            printResult("A*", runToCompletion<AStarState>(weighted, startAStar4, aStarStep, false, aStar));
+
+            // The open set counters: duplicates show up as a larger peak and more
+            // pushes and pops than the indexed structures need.
+            weighted.clearPath();
+            dijkstra.drawLivePath = false;
+            startDijkstra(weighted, dijkstra, false);
+            while (!dijkstra.isComplete) dijkstraStep(weighted, dijkstra, false);
+            printQueueStats("Dijkstra", dijkstra.openSet.stats);
+            weighted.clearPath();
+            aStar.drawLivePath = false;
+            startAStar(weighted, aStar, false);
+            while (!aStar.isComplete) aStarStep(weighted, aStar, false);
+            printQueueStats("A*", aStar.openSet.stats);
+        }
+    }
+
+    // Bitboard BFS and parallel BFS against bfsStep on 4096x4096 maps, whatever the size
+    // argument: the whole-level expansion with the scalar word loop and with AVX2, then
+    // the distance field on more and more threads (the end is in the far corner, so
+    // bfsStep also reaches nearly every cell).
+    {
+        const int big = 4096;
+        GridModel maps[2] = {GridModel(big, big), GridModel(big, big)};
+        std::srand(5);
+        for (int i = 0; i < maps[1].size(); ++i) {
+            if (std::rand() % 5 == 0) maps[1].setType(i, NodeType::Wall);
+        }
+        for (GridModel& map : maps) {
+            map.setType(map.index(0, 0), NodeType::Start);
+            map.setType(map.index(big - 1, big - 1), NodeType::End);
+        }
+        for (int m = 0; m < 2; ++m) {
+            for (int diagonal = 0; diagonal < 2; ++diagonal) {
+                std::printf("\nBitboard BFS, %dx%d %s (%s)\n", big, big, m == 0 ? "open grid" : "20% random walls",
+                            diagonal ? "8-connected" : "4-connected");
+                printResult("BFS", runToCompletion<BFSState>(maps[m], startBFS, bfsStep, diagonal));
+                for (int simd = 0; simd < 2; ++simd) {
+                    if (simd && !bitBFSHasAVX2()) {
+                        std::printf("AVX2       not available on this CPU\n");
+                        continue;
+                    }
+                    maps[m].clearPath();
+                    BitBFSState bits;
+                    bits.paintCells = false;
+                    bits.allowSIMD = simd;
+                    startBitBFS(maps[m], bits);
+                    auto begin = std::chrono::steady_clock::now();
+                    while (!bits.isComplete) bitBFSStep(maps[m], bits, diagonal);
+                    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+                    std::printf("%-10s %10d levels %8.3f s   words %12lld   reached %8d   cost %6d\n",
+                                simd ? "Bits AVX2" : "Bits 64", bits.level, seconds, bits.wordsSwept,
+                                bits.nodesVisited, bits.pathCost);
+                }
+                double oneThread = 0.0;
+                for (int threads : threadCounts()) {
+                    maps[m].clearPath();
+                    ParallelBFSState parallel;
+                    parallel.paintCells = false;
+                    parallel.threads = threads;
+                    startParallelBFS(maps[m], parallel);
+                    auto begin = std::chrono::steady_clock::now();
+                    while (!parallel.isComplete) parallelBFSStep(maps[m], parallel, diagonal);
+                    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+                    if (threads == 1) oneThread = seconds;
+                    std::printf("Par x%-3d   %10d levels %8.3f s   speedup %5.2f   reached %8d   cost %6d   bottom-up %d\n",
+                                threads, parallel.level, seconds, seconds > 0.0 ? oneThread / seconds : 0.0,
+                                parallel.nodesVisited, parallel.pathCost, parallel.bottomUpLevels);
+                }
+            }
+        }
+    }
+
+    // Delta-stepping against Dijkstra on a 2048x2048 map with 10% walls and 30% weights.
+    // Its costs must match; the bucket width trades light rounds against re-relaxations.
+    {
+        const int big = 2048;
+        GridModel weighted(big, big);
+        std::srand(9);
+        for (int i = 0; i < weighted.size(); ++i) {
+            int r = std::rand() % 10;
+            if (r < 1) weighted.setType(i, NodeType::Wall);
+            else if (r < 4) weighted.setType(i, NodeType::Weight);
+        }
+        weighted.setType(weighted.index(0, 0), NodeType::Start);
+        weighted.setType(weighted.index(big - 1, big - 1), NodeType::End);
+        for (int diagonal = 0; diagonal < 2; ++diagonal) {
+            std::printf("\nDelta-stepping, %dx%d, 10%% walls and 30%% weights (%s)\n", big, big,
+                        diagonal ? "8-connected" : "4-connected");
+            printResult("Dijkstra", runToCompletion<DijkstraState>(weighted, diagonal ? startDijkstra8 : startDijkstra4,
+                                                                   dijkstraStep, diagonal));
+            MoveCosts move = moveCosts(diagonal);
+            std::vector<std::pair<int, int>> runs; // (threads, delta); delta 0 is the default.
+            int longestMove = WEIGHT_COST * (diagonal ? move.diagonal : move.straight); // The default width.
+            for (int delta : {move.straight, 2 * move.straight, WEIGHT_COST * move.straight}) {
+                if (delta != longestMove) runs.push_back({1, delta});
+            }
+            runs.push_back({1, 0});
+            for (int threads : threadCounts()) {
+                if (threads > 1) runs.push_back({threads, 0});
+            }
+            double oneThread = 0.0;
+            for (const std::pair<int, int>& run : runs) {
+                weighted.clearPath();
+                DeltaSteppingState delta;
+                delta.paintCells = false;
+                delta.threads = run.first;
+                delta.delta = run.second;
+                startDeltaStepping(weighted, delta, diagonal);
+                auto begin = std::chrono::steady_clock::now();
+                while (!delta.isComplete) deltaSteppingStep(weighted, delta, diagonal);
+                double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+                if (run.first == 1 && run.second == 0) oneThread = seconds;
+                char speedup[16] = "    -";
+                if (run.second == 0 && seconds > 0.0) std::snprintf(speedup, sizeof(speedup), "%5.2f", oneThread / seconds);
+                std::printf("Delta %-4d x%-3d %8d buckets %6.3f s   speedup %s   rounds %6d   relaxations %9lld   cost %7d\n",
+                            delta.activeDelta, run.first, delta.bucketsSettled, seconds, speedup, delta.rounds,
+                            delta.relaxations, delta.pathCost);
+            }
+        }
+    }
+
+    // Many-to-many costs: 64 random open cells of the walled map (the first is the start
+    // and the last the end) to each other, on 1, 2, 4 ... workers.
+    {
+        const int points = 64;
+        std::vector<int> cells = {walled.startIndex};
+        std::srand(7);
+        while (static_cast<int>(cells.size()) < points - 1) {
+            int cell = std::rand() % walled.size();
+            if (walled.types[cell] == NodeType::Empty) cells.push_back(cell);
+        }
+        cells.push_back(walled.endIndex);
+
+        for (int diagonal = 0; diagonal < 2; ++diagonal) {
+            DistanceMatrixState batch;
+            DistanceMatrix matrix;
+            double oneThread = 0.0;
+            for (int threads : threadCounts()) {
+                batch.threads = threads;
+                computeDistanceMatrix(walled, cells, cells, diagonal, batch, matrix);
+                if (threads == 1) {
+                    oneThread = matrix.seconds;
+                    std::printf("\nDistance matrix, %dx%d cells of the walled map (%s, %s per source)\n", points, points,
+                                diagonal ? "8-connected" : "4-connected", matrix.usedBFS ? "BFS" : "Dijkstra");
+                }
+                std::printf("Threads %-3d %8.3f s   speedup %5.2f   %11lld cells settled\n", matrix.threads,
+                            matrix.seconds, matrix.seconds > 0.0 ? oneThread / matrix.seconds : 0.0, matrix.cellsSettled);
+            }
+            BenchResult single = runToCompletion<DijkstraState>(walled, diagonal ? startDijkstra8 : startDijkstra4,
+                                                                dijkstraStep, diagonal);
+            std::printf("Start to end: matrix %d, Dijkstra %d\n", matrix.cost(0, points - 1), single.pathCost);
+        }
+    }
+
+    // Many agents, one goal: a single flow field towards the end against an A* search
+    // from every agent, then the agents walk the field at one lookup per step.
+    {
+        const int agents = 200;
+        walled.clearPath();
+        std::vector<int> cells;
+        std::srand(11);
+        while (static_cast<int>(cells.size()) < agents) {
+            int cell = std::rand() % walled.size();
+            if (walled.types[cell] == NodeType::Empty) cells.push_back(cell);
+        }
+        std::printf("\nFlow field vs %d A* searches to the walled map's end (4-connected)\n", agents);
+
+        FlowFieldState field;
+        auto begin = std::chrono::steady_clock::now();
+        startFlowField(walled, field, false);
+        while (!field.isComplete) flowFieldStep(walled, field, false);
+        double fieldSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        // Each agent gets its own A* search, from its cell to the end.
+        int firstStart = walled.startIndex;
+        AStarState state;
+        state.drawLivePath = false;
+        int matched = 0, unreachable = 0;
+        long long walked = 0;
+        double aStarSeconds = 0.0;
+        for (int agent : cells) {
+            walled.clearPath();
+            walled.setType(walled.startIndex, NodeType::Empty);
+            walled.setType(agent, NodeType::Start);
+            begin = std::chrono::steady_clock::now();
+            startAStar(walled, state, false);
+            while (!state.isComplete) aStarStep(walled, state, false);
+            aStarSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+            if (field.cost[agent] == FLOW_UNREACHED) {
+                unreachable++;
+                if (state.noPathExists) matched++;
+                continue;
+            }
+            // Walking the field costs exactly the agent's integration value.
+            int cost = 0;
+            for (int cell = agent, next = flowNext(walled, field, cell); next >= 0;
+                 cell = next, next = flowNext(walled, field, cell)) {
+                cost += walled.costs[next] * (walled.rowOf(next) != walled.rowOf(cell) &&
+                                              walled.colOf(next) != walled.colOf(cell) ? 2 : 1);
+                walked++;
+            }
+            if (!state.noPathExists && cost == state.pathCost && cost == field.cost[agent]) matched++;
+        }
+        walled.clearPath();
+        walled.setType(walled.startIndex, NodeType::Empty);
+        walled.setType(firstStart, NodeType::Start);
+
+        std::printf("Flow field %8.3f s   %9d cells reachable\n", fieldSeconds, field.reachable);
+        std::printf("A* x%-5d %8.3f s   (%.1fx the field)   %d/%d costs agree, %d unreachable\n", agents, aStarSeconds,
+                    fieldSeconds > 0.0 ? aStarSeconds / fieldSeconds : 0.0, matched, agents, unreachable);
+        std::printf("Agents walked %lld steps along the field\n", walked);
+
+        // A few walls dropped across the middle of the map: only the cells routed
+        // through them are searched again.
+        std::vector<int> dropped;
+        for (int k = 0; k < 10; ++k) {
+            int cell = walled.index(size / 2, size / 4 + k * (size / 20));
+            if (walled.types[cell] != NodeType::Empty) continue;
+            walled.setType(cell, NodeType::Wall);
+            dropped.push_back(cell);
+        }
+        updateFlowField(walled, field, false);
+        begin = std::chrono::steady_clock::now();
+        FlowFieldState rebuilt;
+        startFlowField(walled, rebuilt, false);
+        while (!rebuilt.isComplete) flowFieldStep(walled, rebuilt, false);
+        double rebuildSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        std::printf("Update after 10 walls %8.3f s, %d cells (rebuild %.3f s, %d cells)%s\n", field.lastUpdateSeconds,
+                    field.lastUpdateCells, rebuildSeconds, rebuilt.nodesVisited,
+                    field.cost == rebuilt.cost ? "" : "   MISMATCH");
+        for (int cell : dropped) walled.setType(cell, NodeType::Empty);
+    }
+
+    // The result cache: the first search misses and is stored with its markers, every
+    // repeat of the query only clears the grid and repaints them.
+    {
+        std::printf("\nResult cache, A* on the walled map (4-connected)\n");
+        ResultCache cache(32);
+        SearchKey key{"A*", false, walled.startIndex, walled.endIndex, walled.contentVersion()};
+
+        walled.clearPath();
+        AStarState state;
+        state.drawLivePath = false;
+        auto begin = std::chrono::steady_clock::now();
+        if (!cache.find(key)) {
+            startAStar(walled, state, false);
+            while (!state.isComplete) aStarStep(walled, state, false);
+            CachedSearch result;
+            captureSearch(walled, result);
+            result.nodesVisited = state.nodesVisited;
+            result.pathCost = state.pathCost;
+            result.noPathExists = state.noPathExists;
+            cache.store(key, std::move(result));
+        }
+        double searchSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        const int replays = 20;
+        const CachedSearch* hit = nullptr;
+        begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < replays; ++i) {
+            walled.clearPath();
+            hit = cache.find(key);
+            if (hit) replaySearch(walled, *hit);
+        }
+        double replaySeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() / replays;
+        std::printf("Search %8.3f ms   replay %8.3f ms (%.0fx)   %zu markers   cost %d, %lld hits / %lld misses\n",
+                    searchSeconds * 1000, replaySeconds * 1000, replaySeconds > 0.0 ? searchSeconds / replaySeconds : 0.0,
+                    hit ? hit->order.size() : std::size_t(0), hit ? hit->pathCost : -1, cache.hits, cache.misses);
+
+        // Any wall edit moves the content version on, so the same query no longer hits.
+        int cell = walled.index(size / 2, size / 2);
+        NodeType before = walled.types[cell];
+        walled.clearPath();
+        walled.setType(cell, before == NodeType::Wall ? NodeType::Empty : NodeType::Wall);
+        key.version = walled.contentVersion();
+        std::printf("After one wall edit: %s\n", cache.find(key) ? "hit (stale!)" : "miss");
+        walled.setType(cell, before);
+    }
+
+    // Move the end close to the start so that each search is tiny.
+    int nearEnd = grid.index(size / 100 + 1, size / 100 + 1);
+    grid.setType(grid.endIndex, NodeType::Empty);
+    grid.setType(nearEnd, NodeType::End);
+    std::printf("Repeated short A* searches on the same map: %.0f searches/s\n",
+                repeatedSearchesPerSecond(grid, 2000));
+    return 0;
+}
@@ -26,6 +26,17 @@
 #include "src/DFS.h"
 #include "src/Astar.h"
 #include "src/Dijkstra.h"
+#include "src/JPS.h"
+#include "src/Bidirectional.h"
+#include "src/LPAStar.h"
+#include "src/HPA.h"
+#include "src/BitBFS.h"
+#include "src/ParallelBFS.h"
+#include "src/DeltaStepping.h"
+#include "src/FlowField.h"
+#include "src/Connectivity.h"
+#include "src/MovingAI.h"
+#include "src/ResultCache.h"
 #include "src/MazeGenerator.h"
 #include "src/Pseudocode.h"
 #include "src/Homepage.h"
@@ -129,8 +140,10 @@ void populateDropdown(Dropdown &dd, Font& font, const vector<string>& options){
         opt.setCharacterSize(18);
         opt.setFillColor(Color::Black);
 
-        // Position the new option vertically below the previous one.
-        opt.setPosition(1060, 230 + dd.options.size() * 35);
+        // Position the new option vertically below the previous one, squeezing the
+        // spacing when a long list would otherwise run off the side panel.
+        float spacing = min(35.0f, 440.0f / options.size());
+        opt.setPosition(1060, 230 + dd.options.size() * spacing);
 
         // Add the newly created text object to the dropdown's list of options.
         dd.options.push_back(opt);
@@ -206,6 +219,78 @@ void generatearr(){
     barWidth_backup = barWidth;
 }
 
+/**
+ * @brief Formats a path cost kept in fixed point, where 'unit' is the cost of one
+ * ordinary straight step (1, or 100 when diagonals cost about sqrt(2)).
+ */
+string formatCost(int cost, int unit) {
+    if (unit == 1) return to_string(cost);
+    int hundredths = cost * 100 / unit % 100;
+    return to_string(cost / unit) + (hundredths < 10 ? ".0" : ".") + to_string(hundredths);
+}
+
+/**
+ * @brief Formats the open set counters of an A* or Dijkstra run for the stats panel:
+ * the structure used and its peak size, then its push / pop / decrease-key counts.
+ */
+string openSetStats(const MonotoneQueue& openSet) {
+    const QueueStats& stats = openSet.stats;
+    return string(queueKindName(openSet.kind())) + ", peak " + to_string(stats.peakSize) +
+           "\nPush " + to_string(stats.pushes) + " Pop " + to_string(stats.pops) +
+           " Dec " + to_string(stats.decreaseKeys);
+}
+
+/**
+ * @brief Describes the landmark tables A* searched with, for the status bar: how many
+ * landmarks, the table size and, if this run had to rebuild them, how long that took.
+ */
+string landmarkSummary(const AStarState& state) {
+    const LandmarkTables& tables = state.landmarks;
+    string summary = to_string(tables.cells.size()) + " landmarks, " +
+                     to_string((tables.bytes + 1023) / 1024) + " KB";
+    if (state.landmarksRebuilt) summary += ", built in " + to_string(static_cast<int>(tables.buildSeconds * 1000)) + " ms";
+    return summary;
+}
+
+/**
+ * @brief Describes the pathfinding grid's size and memory, for the status bar: the
+ * fixed bytes per cell, then what the model's change lists hold on top of that.
+ */
+string gridSummary(const Grid& grid) {
+    long long cells = static_cast<long long>(grid.rows) * grid.cols;
+    return to_string(grid.cols) + "x" + to_string(grid.rows) + " grid, " + to_string(Grid::BYTES_PER_CELL) +
+           " bytes/cell (" + to_string((cells * Grid::BYTES_PER_CELL + 1023) / 1024) + " KB) + " +
+           to_string((grid.model.listBytes() + 1023) / 1024) + " KB of change lists";
+}
+
+/**
+ * @brief Builds the result cache key of a search on a grid. A* expands different
+ * cells with each heuristic, and A* and Dijkstra with each open set (ties break
+ * differently), so those settings are part of the algorithm's name.
+ */
+SearchKey searchKey(const GridModel& grid, const string& algorithm, bool isDiagonal, HeuristicKind heuristic,
+                    QueueKind queue) {
+    SearchKey key;
+    key.algorithm = algorithm;
+    if (algorithm == "A* Search") key.algorithm += string(", ") + heuristicName(heuristic);
+    if (algorithm == "A* Search" || algorithm == "Dijkstra") key.algorithm += string(", ") + queueKindName(queue);
+    key.isDiagonal = isDiagonal;
+    key.start = grid.startIndex;
+    key.end = grid.endIndex;
+    key.version = grid.contentVersion();
+    return key;
+}
+
+/**
+ * @brief Copies a finished search's counters into a result cache entry.
+ */
+template <typename State>
+void copyCounters(const State& state, CachedSearch& result) {
+    result.nodesVisited = state.nodesVisited;
+    result.pathCost = state.pathCost;
+    result.noPathExists = state.noPathExists;
+}
+
 // ===================================================================================
 // == Core Application State and Resources ==
 // ===================================================================================
@@ -226,17 +311,92 @@ QuickSortState quickState;
 
 // --- Resources and State Objects for Pathfinding & Maze Generation ---
 // These objects manage the grid and the state of each pathfinding or maze generation algorithm.
+// The grid is shown in a 1029x567 area; its size in cells can be set on the command
+// line (up to MAX_GRID_SIDE a side) and the view zoomed and panned to match.
+const int MAX_GRID_SIDE = 8192;
 Grid pathfindingGrid(0, 60, 1029, 567, 21);
 BFSState bfsState;
 DFSState dfsState;
 AStarState aStarState;
 DijkstraState dijkstraState;
+JPSState jpsState;      // Jump Point Search
+JPSState jpsPlusState;  // JPS+ (keeps its precomputed jump distances between runs)
+int jpsAStarNodes = 0;  // Nodes A* visits on the same map, shown next to the JPS stats.
+int aStarManhattanNodes = -1; // Nodes A* visits with the Manhattan heuristic, shown next to other heuristics.
+// The hidden A* runs behind the two numbers above, computed once a visible search
+// has finished and kept until the map, start, end or settings change.
+AStarComparison jpsComparison;
+AStarComparison manhattanComparison;
+BidirectionalBFSState biBfsState;
+BidirectionalAStarState biAStarState;
+LPAState lpaState;      // Lifelong Planning A* (kept between wall edits so it can repair its path)
+int lpaFullTouched = 0; // Cells a from-scratch LPA* touches on the same map, shown next to a repair.
+LPAComparison lpaComparison; // The hidden search behind lpaFullTouched, kept until the map changes.
+HPAState hpaState;      // Hierarchical pathfinding (keeps its cluster graph between runs)
+BitBFSState bitBfsState; // Bitboard BFS (keeps its packed grid between runs)
+ParallelBFSState parallelBfsState; // Parallel BFS (keeps its worker threads between runs)
+DeltaSteppingState deltaState;       // Delta-stepping Dijkstra (likewise)
+FlowFieldState flowState;            // Flow field towards the End (kept and updated as walls are edited)
+ConnectivityIndex regionIndex;       // Which region of open cells each cell is in, kept up to date from wall edits
 MazeGeneratorState mazeState;
 
-int main()
+/**
+ * @brief Resets every pathfinding algorithm's state, for any change that invalidates
+ * a search in progress (a reset, a cleared path or maze, a new setting). A new
+ * algorithm's state is reset here, and nowhere else.
+ */
+void resetPathfinders() {
+    resetBFS(bfsState);
+    resetDFS(dfsState);
+    resetAStar(aStarState);
+    resetDijkstra(dijkstraState);
+    resetJPS(jpsState);
+    resetJPS(jpsPlusState);
+    resetBidirectionalBFS(biBfsState);
+    resetBidirectionalAStar(biAStarState);
+    resetLPA(lpaState);
+    resetHPA(hpaState);
+    resetBitBFS(bitBfsState);
+    resetParallelBFS(parallelBfsState);
+    resetDeltaStepping(deltaState);
+    resetFlowField(flowState);
+}
+
+// --- Finished Searches ---
+// Searches are remembered by algorithm, diagonal setting, start, end and the grid's
+// content version, so solving the same query on the same map again (after a Reset,
+// Clear Path or switching algorithms back and forth) replays the result instantly.
+ResultCache resultCache(32);
+SearchKey runningSearch;        // The key of the search being run, until it is stored.
+bool storeRunningSearch = false; // True while a search that missed the cache runs.
+SearchKey shownSearch;          // The key of the search last replayed from the cache.
+CachedSearch shownResult;       // Its statistics (the markers are not kept here).
+bool showingCachedResult = false;
+
+int main(int argc, char* argv[])
 {
     generatearr();
 
+    // --- Grid Size ---
+    // "main.exe <cols> <rows>" replaces the default grid (as many cells as fit the area)
+    // with a larger or smaller one; "main.exe <file.map>" loads a Moving AI map.
+    if (argc == 2) {
+        string error;
+        if (!loadMovingAIMap(argv[1], pathfindingGrid.model, error)) {
+            cerr << "Error loading map: " << error << endl;
+            return -1;
+        }
+    }
+    else if (argc >= 3) {
+        int gridCols = atoi(argv[1]);
+        int gridRows = atoi(argv[2]);
+        if (gridCols < 2 || gridRows < 2 || gridCols > MAX_GRID_SIDE || gridRows > MAX_GRID_SIDE) {
+            cerr << "Grid size must be between 2 and " << MAX_GRID_SIDE << " cells a side" << endl;
+            return -1;
+        }
+        pathfindingGrid.resize(gridRows, gridCols);
+    }
+
     bool draggingSlider = false;
     bool draggingSizeSlider = false;
 
@@ -402,7 +562,7 @@ int main()
     // --- Dropdown Content ---
     // Define the lists of algorithms that will populate the dropdown in each mode.
     vector<string> sortingAlgos = {"Bubble Sort", "Selection Sort", "Insertion Sort", "Merge Sort", "Quick Sort"};
-    vector<string> pathfindingAlgos = {"BFS", "DFS", "A* Search", "Dijkstra"};
+    vector<string> pathfindingAlgos = {"BFS", "DFS", "A* Search", "Dijkstra", "JPS", "JPS+", "Bidirectional BFS", "Bidirectional A*", "LPA*", "HPA*", "Bitboard BFS", "Parallel BFS", "Delta-Stepping", "Flow Field"};
 
     algorithmDropdown.selected.setString("Select Algorithm");
 
@@ -435,6 +595,11 @@ int main()
     pathCostText.setFillColor(Color::Black);
     pathCostText.setPosition(1050, 555-30);
 
+    // Extra, algorithm-specific statistics (e.g. the A* node count JPS is compared against).
+    Text extraStatsText("", font, 16);
+    extraStatsText.setFillColor(Color::Black);
+    extraStatsText.setPosition(1050, 580-30);
+
     // --- Sorting Statistics Panel ---
     // This panel shows the performance results of a sorting algorithm.
     Text statsTitleSorting("Statistics:", font, 20);
@@ -499,6 +664,42 @@ int main()
     diagonalLabel.setFillColor(Color::Black);
     diagonalLabel.setPosition(1080, 673-30);
 
+    // --- Heuristic Toggle (A* Only) ---
+    // Clicking this label cycles A*'s heuristic: Auto (the one that matches the
+    // movement), Manhattan, octile, Chebyshev, Euclidean and ALT (landmarks). It sits
+    // above the stats panel and, like it, is hidden while the pseudocode is shown.
+    HeuristicKind heuristicKind = HeuristicKind::Auto;
+    Text heuristicLabel;
+    heuristicLabel.setFont(font);
+    heuristicLabel.setString(string("Heuristic: ") + heuristicName(heuristicKind));
+    heuristicLabel.setCharacterSize(16);
+    heuristicLabel.setFillColor(Color::Black);
+    heuristicLabel.setPosition(1050, 470-30);
+
+    // --- Open Set Structure Toggle (A* and Dijkstra Only) ---
+    // Clicking this label cycles the priority queue A* and Dijkstra use for their open
+    // set: Auto, the binary heap, the indexed 4-ary heap, a bucket queue or a radix
+    // heap. It applies from the next search on.
+    QueueKind queueKind = QueueKind::Auto;
+    Text queueLabel;
+    queueLabel.setFont(font);
+    queueLabel.setString(string("Queue: ") + queueKindName(queueKind));
+    queueLabel.setCharacterSize(16);
+    queueLabel.setFillColor(Color::Black);
+    queueLabel.setPosition(1175, 675-30);
+
+    // --- Maze Generator Toggle (Pathfinding Only) ---
+    // Clicking this label, under the Maze button, cycles the generator the button uses:
+    // DFS, Kruskal, Prim, Wilson, recursive division and Eller. Shift-clicking the
+    // button builds the whole maze at once instead of animating it.
+    MazeKind mazeKind = MazeKind::DFS;
+    Text mazeKindLabel;
+    mazeKindLabel.setFont(font);
+    mazeKindLabel.setString(string("Maze: ") + mazeKindName(mazeKind));
+    mazeKindLabel.setCharacterSize(16);
+    mazeKindLabel.setFillColor(Color::Black);
+    mazeKindLabel.setPosition(610-20-20-20-20, 688);
+
     // ===================================================================================
     // == UI Elements: Control Panel Background ==
     // ===================================================================================
@@ -747,6 +948,18 @@ int main()
     mudlabel.setFillColor(Color::Black);
     mudlabel.setPosition(650, indicatorYpathfinding - 1);
 
+    // Cells expanded by the backward half of a bidirectional search.
+    CircleShape backbox(10);
+    backbox.setPosition(715, indicatorYpathfinding);
+    backbox.setFillColor(Color(216, 191, 236));
+
+    Text backlabel;
+    backlabel.setFont(font);
+    backlabel.setString("Backward");
+    backlabel.setCharacterSize(16);
+    backlabel.setFillColor(Color::Black);
+    backlabel.setPosition(740, indicatorYpathfinding - 1);
+
 
     // ===================================================================================
     // == Main Application Loop ==
@@ -885,10 +1098,7 @@ int main()
                         resetQuickSort(quickState, arr.size());
 
                         pathfindingGrid.reset();
-                        resetBFS(bfsState);
-                        resetDFS(dfsState);
-                        resetAStar(aStarState);
-                        resetDijkstra(dijkstraState);
+                        resetPathfinders();
                         isPlaying = false;
                     }
 
@@ -899,10 +1109,7 @@ int main()
                         currentMode = Mode::Sorting;
                         // Clean up any leftover pathfinding data before switching.
                         pathfindingGrid.reset();
-                        resetBFS(bfsState);
-                        resetDFS(dfsState);
-                        resetAStar(aStarState);
-                        resetDijkstra(dijkstraState);
+                        resetPathfinders();
                         // Populate the dropdown with the correct algorithms for this mode.
                         populateDropdown(algorithmDropdown, font, sortingAlgos);
                         algorithmDropdown.selected.setString("Select Algorithm");
@@ -924,7 +1131,7 @@ int main()
                         resetQuickSort(quickState, arr.size());
                         populateDropdown(algorithmDropdown, font, pathfindingAlgos);
                         algorithmDropdown.selected.setString("Select Algorithm");
-                        status.setString("Place Start, End, and Walls.");
+                        status.setString("Place Start, End, and Walls. " + gridSummary(pathfindingGrid) + ".");
                         isPlaying = false;
                     }
                 }
@@ -957,13 +1164,14 @@ int main()
                                 // If we are in pathfinding mode, a new selection resets everything.
                                 if (currentMode == Mode::Pathfinding) {
                                     pathfindingGrid.clearPath();
-                                    resetBFS(bfsState);
-                                    resetDFS(dfsState);
-                                    resetAStar(aStarState);
-                                    resetDijkstra(dijkstraState);
+                                    resetPathfinders();
                                     // If switching from a weighted to unweighted algo, clear the mud.
-                                    bool wasWeighted = (oldAlgo == "A* Search" || oldAlgo == "Dijkstra");
-                                    bool isUnweighted = (newAlgo == "BFS" || newAlgo == "DFS");
+                                    bool wasWeighted = (oldAlgo == "A* Search" || oldAlgo == "Dijkstra" || oldAlgo == "Bidirectional A*" ||
+                                                        oldAlgo == "LPA*" || oldAlgo == "HPA*" || oldAlgo == "Delta-Stepping" ||
+                                                        oldAlgo == "Flow Field");
+                                    bool isUnweighted = (newAlgo == "BFS" || newAlgo == "DFS" || newAlgo == "JPS" || newAlgo == "JPS+" ||
+                                                         newAlgo == "Bidirectional BFS" || newAlgo == "Bitboard BFS" ||
+                                                         newAlgo == "Parallel BFS");
                                     if (wasWeighted && isUnweighted) {
                                         pathfindingGrid.clearWeights();
                                     }
@@ -1013,7 +1221,7 @@ int main()
                         status.setString("Please select an algorithm first!");
                     }
                     // 2. Next, if in pathfinding mode, check if the grid is ready.
-                    else if (currentMode == Mode::Pathfinding && (!pathfindingGrid.startNode || !pathfindingGrid.endNode)) {
+                    else if (currentMode == Mode::Pathfinding && (pathfindingGrid.model.startIndex < 0 || pathfindingGrid.model.endIndex < 0)) {
                         status.setString("Place both Start and End nodes!");
                     }
                     // 3. If everything is ready, check if the algorithm is already finished.
@@ -1031,7 +1239,17 @@ int main()
                             if ((selectedAlgo == "BFS" && bfsState.isComplete) ||
                                 (selectedAlgo == "DFS" && dfsState.isComplete) ||
                                 (selectedAlgo == "A* Search" && aStarState.isComplete) ||
-                                (selectedAlgo == "Dijkstra" && dijkstraState.isComplete)) {
+                                (selectedAlgo == "Dijkstra" && dijkstraState.isComplete) ||
+                                (selectedAlgo == "JPS" && jpsState.isComplete) ||
+                                (selectedAlgo == "JPS+" && jpsPlusState.isComplete) ||
+                                (selectedAlgo == "Bidirectional BFS" && biBfsState.isComplete) ||
+                                (selectedAlgo == "Bidirectional A*" && biAStarState.isComplete) ||
+                                (selectedAlgo == "LPA*" && lpaState.isComplete) ||
+                                (selectedAlgo == "HPA*" && hpaState.isComplete) ||
+                                (selectedAlgo == "Bitboard BFS" && bitBfsState.isComplete) ||
+                                (selectedAlgo == "Parallel BFS" && parallelBfsState.isComplete) ||
+                                (selectedAlgo == "Delta-Stepping" && deltaState.isComplete) ||
+                                (selectedAlgo == "Flow Field" && flowState.isComplete)) {
                                 isFinished = true;
                             }
                         }
@@ -1056,41 +1274,114 @@ int main()
                                     quickState.isSorting = true;
                                 }
                             } else { // Pathfinding Mode
-                                if (pathfindingGrid.startNode && pathfindingGrid.endNode) {
+                                if (pathfindingGrid.model.startIndex >= 0 && pathfindingGrid.model.endIndex >= 0) {
                                     // Check if we are starting a NEW search, not resuming.
                                     bool isNewSearch = false;
                                     if (selectedAlgo == "BFS" && !bfsState.isSearching) isNewSearch = true;
                                     if (selectedAlgo == "DFS" && !dfsState.isSearching) isNewSearch = true;
                                     if (selectedAlgo == "A* Search" && !aStarState.isSearching) isNewSearch = true;
                                     if (selectedAlgo == "Dijkstra" && !dijkstraState.isSearching) isNewSearch = true;
+                                    if (selectedAlgo == "JPS" && !jpsState.isSearching) isNewSearch = true;
+                                    if (selectedAlgo == "JPS+" && !jpsPlusState.isSearching) isNewSearch = true;
+                                    if (selectedAlgo == "Bidirectional BFS" && !biBfsState.isSearching) isNewSearch = true;
+                                    if (selectedAlgo == "Bidirectional A*" && !biAStarState.isSearching) isNewSearch = true;
+                                    if (selectedAlgo == "LPA*" && !lpaState.isSearching) isNewSearch = true;
+                                    if (selectedAlgo == "HPA*" && !hpaState.isSearching) isNewSearch = true;
+                                    if (selectedAlgo == "Bitboard BFS" && !bitBfsState.isSearching) isNewSearch = true;
+                                    if (selectedAlgo == "Parallel BFS" && !parallelBfsState.isSearching) isNewSearch = true;
+                                    if (selectedAlgo == "Delta-Stepping" && !deltaState.isSearching) isNewSearch = true;
+                                    if (selectedAlgo == "Flow Field" && !flowState.isSearching) isNewSearch = true;
+
+                                    // A start and end in different regions cannot be joined by any search,
+                                    // so say so straight away instead of flooding the start's region. (A flow
+                                    // field covers the end's whole region, wherever the start is.)
+                                    if (isNewSearch && selectedAlgo != "Flow Field" && !cellsConnected(pathfindingGrid.model, regionIndex, pathfindingGrid.model.startIndex,
+                                                                       pathfindingGrid.model.endIndex, isDiagonal)) {
+                                        pathfindingGrid.clearPath();
+                                        status.setString("No path: start and end are in separate regions (" +
+                                                         to_string(regionIndex.regions) + " regions)");
+                                        isPlaying = false;
+                                        isNewSearch = false;
+                                    }
+
+                                    // The same query has been solved on this exact map before: paint its
+                                    // result straight away instead of searching again. The flow field keeps
+                                    // itself up to date instead.
+                                    if (isNewSearch && selectedAlgo != "Flow Field") {
+                                        SearchKey key = searchKey(pathfindingGrid.model, selectedAlgo, isDiagonal,
+                                                                  heuristicKind, queueKind);
+                                        if (const CachedSearch* cached = resultCache.find(key)) {
+                                            pathfindingGrid.clearPath();
+                                            replaySearch(pathfindingGrid.model, *cached);
+                                            shownSearch = key;
+                                            shownResult = CachedSearch{{}, {}, cached->nodesVisited, cached->pathCost,
+                                                                       cached->noPathExists, cached->costText, cached->extraText};
+                                            showingCachedResult = true;
+                                            storeRunningSearch = false;
+                                            status.setString(cached->noPathExists ? "No path found! (from the cache)"
+                                                                                  : "Path found! (from the cache)");
+                                            isPlaying = false;
+                                            isNewSearch = false;
+                                        } else {
+                                            runningSearch = key;
+                                            storeRunningSearch = true;
+                                            showingCachedResult = false;
+                                        }
+                                    }
     
                                     if(isNewSearch) {
                                         pathfindingGrid.clearPath();
                                         if (selectedAlgo == "BFS") {
-                                            resetBFS(bfsState);
-                                            bfsState.queue.push(pathfindingGrid.startNode);
-                                            bfsState.isSearching = true;
+                                            startBFS(pathfindingGrid.model, bfsState);
                                             status.setString("Searching with BFS...");
                                         } else if(selectedAlgo == "DFS") {
-                                            resetDFS(dfsState);
-                                            dfsState.stack.push(pathfindingGrid.startNode);
-                                            dfsState.isSearching = true;
+                                            startDFS(pathfindingGrid.model, dfsState);
                                             status.setString("Searching with DFS...");
                                         } else if (selectedAlgo == "A* Search") {
-                                            resetAStar(aStarState);
-                                            for(auto& row : pathfindingGrid.nodes) for(auto& node : row) aStarState.gCost[&node] = numeric_limits<int>::max();
-                                            aStarState.gCost[pathfindingGrid.startNode] = 0;
-                                            int hCost = calculateHeuristic(pathfindingGrid.startNode, pathfindingGrid.endNode);
-                                            aStarState.openSet.push({pathfindingGrid.startNode, hCost});
-                                            aStarState.isSearching = true;
-                                            status.setString("Searching with A*...");
+                                            startAStar(pathfindingGrid.model, aStarState, isDiagonal);
+                                            aStarManhattanNodes = -1;
+                                            if (aStarState.activeHeuristic == HeuristicKind::Landmarks) {
+                                                status.setString("Searching with A* (" + landmarkSummary(aStarState) + ")...");
+                                            } else {
+                                                status.setString("Searching with A*...");
+                                            }
                                         } else if (selectedAlgo == "Dijkstra") {
-                                            resetDijkstra(dijkstraState);
-                                            for(auto& row : pathfindingGrid.nodes) for(auto& node : row) dijkstraState.costMap[&node] = numeric_limits<int>::max();
-                                            dijkstraState.costMap[pathfindingGrid.startNode] = 0;
-                                            dijkstraState.openSet.push({pathfindingGrid.startNode, 0});
-                                            dijkstraState.isSearching = true;
+                                            startDijkstra(pathfindingGrid.model, dijkstraState, isDiagonal);
                                             status.setString("Searching with Dijkstra...");
+                                        } else if (selectedAlgo == "JPS") {
+                                            startJPS(pathfindingGrid.model, jpsState, isDiagonal);
+                                            status.setString("Searching with JPS...");
+                                        } else if (selectedAlgo == "JPS+") {
+                                            startJPS(pathfindingGrid.model, jpsPlusState, isDiagonal);
+                                            status.setString("Searching with JPS+...");
+                                        } else if (selectedAlgo == "Bidirectional BFS") {
+                                            startBidirectionalBFS(pathfindingGrid.model, biBfsState);
+                                            status.setString("Searching with Bidirectional BFS...");
+                                        } else if (selectedAlgo == "Bidirectional A*") {
+                                            startBidirectionalAStar(pathfindingGrid.model, biAStarState, isDiagonal);
+                                            status.setString("Searching with Bidirectional A*...");
+                                        } else if (selectedAlgo == "LPA*") {
+                                            startLPA(pathfindingGrid.model, lpaState, isDiagonal);
+                                            status.setString("Searching with LPA*...");
+                                        } else if (selectedAlgo == "HPA*") {
+                                            startHPA(pathfindingGrid.model, hpaState, isDiagonal);
+                                            status.setString("Searching with HPA* (" + to_string(hpaState.clustersRebuilt) +
+                                                             " clusters rebuilt)...");
+                                        } else if (selectedAlgo == "Bitboard BFS") {
+                                            startBitBFS(pathfindingGrid.model, bitBfsState);
+                                            status.setString("Searching with Bitboard BFS (one level per step)...");
+                                        } else if (selectedAlgo == "Parallel BFS") {
+                                            startParallelBFS(pathfindingGrid.model, parallelBfsState);
+                                            status.setString("Parallel BFS on " + to_string(parallelBfsState.pool->size()) +
+                                                             " threads (one level per step)...");
+                                        } else if (selectedAlgo == "Delta-Stepping") {
+                                            startDeltaStepping(pathfindingGrid.model, deltaState, isDiagonal);
+                                            status.setString("Delta-stepping on " + to_string(deltaState.pool->size()) +
+                                                             " threads, delta " + to_string(deltaState.activeDelta) +
+                                                             " (one bucket per step)...");
+                                        } else if (selectedAlgo == "Flow Field") {
+                                            startFlowField(pathfindingGrid.model, flowState, isDiagonal);
+                                            status.setString("Building the flow field towards the end...");
                                         }
                                     }
                                 }
@@ -1134,10 +1425,7 @@ int main()
                         status.setString("Array reset. Select an algorithm.");
                     }else{
                         pathfindingGrid.reset();
-                        resetBFS(bfsState);
-                        resetDFS(dfsState);
-                        resetAStar(aStarState);
-                        resetDijkstra(dijkstraState);
+                        resetPathfinders();
                         status.setString("Grid reset. Place Start and End.");
                     }
                 }
@@ -1145,43 +1433,45 @@ int main()
                 if (currentMode == Mode::Pathfinding && pathClearBtn.shape.getGlobalBounds().contains(mousePos.x, mousePos.y)) {
                     isPlaying = false;
                     pathfindingGrid.clearPath();
-                    resetBFS(bfsState);
-                    resetDFS(dfsState);
-                    resetAStar(aStarState);
-                    resetDijkstra(dijkstraState);
+                    resetPathfinders();
                     status.setString("Path cleared.");
                 }
 
                 if (currentMode == Mode::Pathfinding && clearmazeBtn.shape.getGlobalBounds().contains(mousePos.x, mousePos.y)) {
                     isPlaying = false;
                     pathfindingGrid.clearMaze();
-                    resetBFS(bfsState);
-                    resetDFS(dfsState);
-                    resetAStar(aStarState);
-                    resetDijkstra(dijkstraState);
+                    resetPathfinders();
                     status.setString("Maze cleared. Ready for new search.");
                 }
                 if (currentMode == Mode::Pathfinding && mazeGenBtn.shape.getGlobalBounds().contains(mousePos.x, mousePos.y)) {
                     isPlaying = false;
-                    resetBFS(bfsState);
-                    resetDFS(dfsState);
-                    resetAStar(aStarState);
-                    resetDijkstra(dijkstraState);
+                    resetPathfinders();
             
                     // Prepare grid for generation
                     pathfindingGrid.fillWithWalls();
                     resetMazeGenerator(mazeState);
             
-                    // Pick a random starting point and set it to Empty
-                    int startRow = (rand() % (pathfindingGrid.rows / 2)) * 2;
-                    int startCol = (rand() % (pathfindingGrid.cols / 2)) * 2;
-                    
-                    pathfindingGrid.setNodeType(startRow, startCol, NodeType::Empty);
-                    mazeState.stack.push(&pathfindingGrid.nodes[startRow][startCol]);
-                    
-                    isGeneratingMaze = true;
-                    mazeState.isGenerating = true;
-                    status.setString("Generating maze...");
+                    // Pick a fresh seed; it decides both the starting point and every turn
+                    // of the generator, so the seed shown in the status rebuilds this maze.
+                    unsigned seed = random_device{}();
+                    mt19937 pick(seed);
+                    int startRow = (pick() % ((pathfindingGrid.rows + 1) / 2)) * 2;
+                    int startCol = (pick() % ((pathfindingGrid.cols + 1) / 2)) * 2;
+                    int startCell = pathfindingGrid.model.index(startRow, startCol);
+                    string seedText = string(mazeKindName(mazeKind)) + ", seed " + to_string(seed);
+                    mazeState.kind = mazeKind;
+
+                    if (Keyboard::isKeyPressed(Keyboard::LShift) || Keyboard::isKeyPressed(Keyboard::RShift)) {
+                        auto began = chrono::steady_clock::now();
+                        generateMaze(pathfindingGrid.model, mazeState, startCell, seed);
+                        double seconds = chrono::duration<double>(chrono::steady_clock::now() - began).count();
+                        status.setString("Maze generated in " + to_string(static_cast<int>(seconds * 1000)) + " ms (" +
+                                         seedText + "). Place Start/End.");
+                    } else {
+                        startMaze(pathfindingGrid.model, mazeState, startCell, seed);
+                        isGeneratingMaze = true;
+                        status.setString("Generating maze (" + seedText + ")...");
+                    }
                 }
 
             }
@@ -1202,12 +1492,37 @@ int main()
                     isPlaying = false;
                     pathfindingGrid.clearPath();
 
-                    resetBFS(bfsState);
-                    resetDFS(dfsState);
-                    resetAStar(aStarState);
-                    resetDijkstra(dijkstraState);
+                    resetPathfinders();
                     status.setString("Settings changed.");
                 }
+
+                if (currentMode == Mode::Pathfinding && !isGeneratingMaze &&
+                    mazeKindLabel.getGlobalBounds().contains(mousePos.x, mousePos.y)) {
+                    // DFS -> Kruskal -> Prim -> Wilson -> Division -> Eller -> DFS.
+                    mazeKind = static_cast<MazeKind>((static_cast<int>(mazeKind) + 1) % MAZE_KIND_COUNT);
+                    mazeKindLabel.setString(string("Maze: ") + mazeKindName(mazeKind));
+                    status.setString(string("Maze generator: ") + mazeKindName(mazeKind) + ".");
+                }
+
+                string queueAlgo = algorithmDropdown.selected.getString();
+                if ((queueAlgo == "A* Search" || queueAlgo == "Dijkstra") && currentMode == Mode::Pathfinding &&
+                    queueLabel.getGlobalBounds().contains(mousePos.x, mousePos.y)) {
+                    // Auto -> Heap -> 4-ary Heap -> Bucket -> Radix -> Auto.
+                    queueKind = static_cast<QueueKind>((static_cast<int>(queueKind) + 1) % 5);
+                    aStarState.queueKind = queueKind;
+                    dijkstraState.queueKind = queueKind;
+                    queueLabel.setString(string("Queue: ") + queueKindName(queueKind));
+                    status.setString("Open set queue changed (applies to the next search).");
+                }
+
+                if (queueAlgo == "A* Search" && currentMode == Mode::Pathfinding && !showPseudocode &&
+                    !algorithmDropdown.expanded && heuristicLabel.getGlobalBounds().contains(mousePos.x, mousePos.y)) {
+                    // Auto -> Manhattan -> Octile -> Chebyshev -> Euclidean -> ALT -> Auto.
+                    heuristicKind = static_cast<HeuristicKind>((static_cast<int>(heuristicKind) + 1) % 6);
+                    aStarState.heuristic = heuristicKind;
+                    heuristicLabel.setString(string("Heuristic: ") + heuristicName(heuristicKind));
+                    status.setString("Heuristic changed (applies to the next search).");
+                }
             }
 
             // Algo names highlighting
@@ -1243,6 +1558,11 @@ int main()
                 window.draw(algorithmDropdown.options[i]);
             }
 
+            // Zoom (mouse wheel) and pan (middle drag, arrow keys) the pathfinding grid.
+            if (currentMode == Mode::Pathfinding) {
+                pathfindingGrid.handleViewEvent(event, window);
+            }
+
             switch (event.type)
             {
             case Event::Closed:
@@ -1298,8 +1618,34 @@ int main()
 
         if (currentMode == Mode::Pathfinding && !isPlaying) {
             string selectedAlgo = algorithmDropdown.selected.getString();
-            bool allowWeights = (selectedAlgo == "A* Search" || selectedAlgo == "Dijkstra");
-            pathfindingGrid.handleMouseInput(window, allowWeights);
+            bool allowWeights = (selectedAlgo == "A* Search" || selectedAlgo == "Dijkstra" || selectedAlgo == "Bidirectional A*" ||
+                                 selectedAlgo == "LPA*" || selectedAlgo == "HPA*" || selectedAlgo == "Delta-Stepping" ||
+                                 selectedAlgo == "Flow Field");
+            bool isIncremental = (selectedAlgo == "LPA*");
+            pathfindingGrid.handleMouseInput(window, allowWeights, isIncremental);
+
+            // LPA* keeps its search between edits: replay new walls and weights into it,
+            // so the next Play repairs the path instead of searching from scratch.
+            if (isIncremental && (lpaState.isSearching || lpaState.isComplete) &&
+                pathfindingGrid.model.editCount() != lpaState.editsApplied) {
+                pathfindingGrid.clearPath();
+                lpaApplyEdits(pathfindingGrid.model, lpaState, isDiagonal);
+                status.setString("Map edited. Press Play to repair the path.");
+            }
+
+            // A finished flow field follows the edits as they are made: only the cells whose
+            // route ran through an edited cell are searched again (moving the end rebuilds it).
+            if (selectedAlgo == "Flow Field" && flowState.isComplete &&
+                flowFieldStale(pathfindingGrid.model, flowState, isDiagonal)) {
+                updateFlowField(pathfindingGrid.model, flowState, isDiagonal);
+                if (flowState.isComplete) {
+                    status.setString(string(flowState.lastUpdateIncremental ? "Flow field updated: " : "Flow field rebuilt: ") +
+                                     to_string(flowState.lastUpdateCells) + " cells in " +
+                                     to_string(static_cast<int>(flowState.lastUpdateSeconds * 1e6)) + " us.");
+                } else {
+                    status.setString("Place the End to build the flow field.");
+                }
+            }
         }
 
        // ===================================================================================
@@ -1391,21 +1737,85 @@ int main()
                     }
                 } else {
                     if (selectAlgo == "BFS") {
-                        bfsStep(pathfindingGrid, bfsState, isDiagonal);
+                        bfsStep(pathfindingGrid.model, bfsState, isDiagonal);
                         if (bfsState.noPathExists) { status.setString("No path found!"); isPlaying = false; }
                         if (bfsState.isComplete && !bfsState.noPathExists) { status.setString("Path found!"); isPlaying = false; }
                     } else if(selectAlgo == "DFS") {
-                        dfsStep(pathfindingGrid, dfsState, isDiagonal);
+                        dfsStep(pathfindingGrid.model, dfsState, isDiagonal);
                         if(dfsState.noPathExists) { status.setString("No path found!"); isPlaying = false; }
                         if (dfsState.isComplete && !dfsState.noPathExists) { status.setString("Path found!"); isPlaying = false; }
                     } else if(selectAlgo == "A* Search") {
-                        aStarStep(pathfindingGrid, aStarState, isDiagonal);
+                        aStarStep(pathfindingGrid.model, aStarState, isDiagonal);
                         if(aStarState.noPathExists) { status.setString("No path found!"); isPlaying = false; }
-                        if (aStarState.isComplete && !aStarState.noPathExists) { status.setString("Path found!"); isPlaying = false; }
+                        if (aStarState.isComplete && aStarState.activeHeuristic != HeuristicKind::Manhattan) {
+                            // The nodes a Manhattan search visits, to show what the heuristic saves.
+                            aStarManhattanNodes = aStarNodesVisited(pathfindingGrid.model, isDiagonal,
+                                                                    HeuristicKind::Manhattan, manhattanComparison);
+                        }
+                        if (aStarState.isComplete && !aStarState.noPathExists) {
+                            status.setString(aStarState.activeHeuristic == HeuristicKind::Landmarks
+                                                 ? "Path found! (" + landmarkSummary(aStarState) + ")"
+                                                 : string("Path found!"));
+                            isPlaying = false;
+                        }
                     } else if(selectAlgo == "Dijkstra") {
-                        dijkstraStep(pathfindingGrid, dijkstraState, isDiagonal);
+                        dijkstraStep(pathfindingGrid.model, dijkstraState, isDiagonal);
                         if (dijkstraState.noPathExists) { status.setString("No path found!"); isPlaying = false; }
                         if (dijkstraState.isComplete && !dijkstraState.noPathExists) { status.setString("Path found!"); isPlaying = false; }
+                    } else if(selectAlgo == "JPS" || selectAlgo == "JPS+") {
+                        JPSState& jps = (selectAlgo == "JPS") ? jpsState : jpsPlusState;
+                        if (selectAlgo == "JPS") jpsStep(pathfindingGrid.model, jps, isDiagonal);
+                        else jpsPlusStep(pathfindingGrid.model, jps, isDiagonal);
+                        if (jps.noPathExists) { status.setString("No path found!"); isPlaying = false; }
+                        if (jps.isComplete && !jps.noPathExists) {
+                            // Run A* once, off-screen, on the same map to compare the node counts.
+                            jpsAStarNodes = aStarNodesVisited(pathfindingGrid.model, isDiagonal, HeuristicKind::Auto,
+                                                              jpsComparison);
+                            status.setString("Path found!");
+                            isPlaying = false;
+                        }
+                    } else if(selectAlgo == "Bidirectional BFS") {
+                        bidirectionalBFSStep(pathfindingGrid.model, biBfsState, isDiagonal);
+                        if (biBfsState.noPathExists) { status.setString("No path found!"); isPlaying = false; }
+                        if (biBfsState.isComplete && !biBfsState.noPathExists) { status.setString("Path found!"); isPlaying = false; }
+                    } else if(selectAlgo == "Bidirectional A*") {
+                        bidirectionalAStarStep(pathfindingGrid.model, biAStarState, isDiagonal);
+                        if (biAStarState.noPathExists) { status.setString("No path found!"); isPlaying = false; }
+                        if (biAStarState.isComplete && !biAStarState.noPathExists) { status.setString("Path found!"); isPlaying = false; }
+                    } else if(selectAlgo == "LPA*") {
+                        lpaStep(pathfindingGrid.model, lpaState, isDiagonal);
+                        if (lpaState.isComplete && lpaState.isRepair) {
+                            // Search the edited map from scratch, off-screen, to show what the repair saved.
+                            lpaFullTouched = lpaFullReplanTouched(pathfindingGrid.model, isDiagonal, lpaComparison);
+                        }
+                        if (lpaState.noPathExists) { status.setString("No path found!"); isPlaying = false; }
+                        if (lpaState.isComplete && !lpaState.noPathExists) {
+                            status.setString(lpaState.isRepair ? "Path repaired!" : "Path found!");
+                            isPlaying = false;
+                        }
+                    } else if(selectAlgo == "HPA*") {
+                        hpaStep(pathfindingGrid.model, hpaState, isDiagonal);
+                        if (hpaState.noPathExists) { status.setString("No path found!"); isPlaying = false; }
+                        if (hpaState.isComplete && !hpaState.noPathExists) { status.setString("Path found!"); isPlaying = false; }
+                    } else if(selectAlgo == "Bitboard BFS") {
+                        bitBFSStep(pathfindingGrid.model, bitBfsState, isDiagonal);
+                        if (bitBfsState.noPathExists) { status.setString("No path found!"); isPlaying = false; }
+                        if (bitBfsState.isComplete && !bitBfsState.noPathExists) { status.setString("Path found!"); isPlaying = false; }
+                    } else if(selectAlgo == "Parallel BFS") {
+                        parallelBFSStep(pathfindingGrid.model, parallelBfsState, isDiagonal);
+                        if (parallelBfsState.noPathExists) { status.setString("No path found!"); isPlaying = false; }
+                        if (parallelBfsState.isComplete && !parallelBfsState.noPathExists) { status.setString("Path found!"); isPlaying = false; }
+                    } else if(selectAlgo == "Delta-Stepping") {
+                        deltaSteppingStep(pathfindingGrid.model, deltaState, isDiagonal);
+                        if (deltaState.noPathExists) { status.setString("No path found!"); isPlaying = false; }
+                        if (deltaState.isComplete && !deltaState.noPathExists) { status.setString("Path found!"); isPlaying = false; }
+                    } else if(selectAlgo == "Flow Field") {
+                        // The field is for every cell, so it is finished whether or not the start can reach the end.
+                        flowFieldStep(pathfindingGrid.model, flowState, isDiagonal);
+                        if (flowState.isComplete) {
+                            status.setString("Flow field ready: " + to_string(flowState.reachable) + " cells lead to the end.");
+                            isPlaying = false;
+                        }
                     }
                 }
             };
@@ -1437,7 +1847,7 @@ int main()
             // Run multiple steps per frame for a fast but still visible generation animation.
             for (int i = 0; i < 10; ++i) { 
                 if (mazeState.isGenerating) {
-                    mazeStep(pathfindingGrid, mazeState);
+                    mazeStep(pathfindingGrid.model, mazeState);
                 } else {
                     break;  // Stop early if generation is complete.
                 }
@@ -1532,6 +1942,8 @@ int main()
             }
 
             // 2. Check for completion and update the stats text accordingly.
+            extraStatsText.setString("");
+            bool searchComplete = true;
             if (selectedAlgo == "BFS" && bfsState.isComplete && selectedAlgo != "Select Algorithm") {
                 nodesVisitedText.setString("Nodes Visited: " + to_string(bfsState.nodesVisited));
                 pathCostText.setString("Path Cost: " + to_string(bfsState.pathCost));
@@ -1540,15 +1952,118 @@ int main()
                 pathCostText.setString("Path Cost: " + to_string(dfsState.pathCost));
             } else if (selectedAlgo == "A* Search" && aStarState.isComplete && selectedAlgo != "Select Algorithm") {
                 nodesVisitedText.setString("Nodes Visited: " + to_string(aStarState.nodesVisited));
-                pathCostText.setString("Path Cost: " + to_string(aStarState.pathCost));
+                pathCostText.setString("Path Cost: " + formatCost(aStarState.pathCost, aStarState.move.straight));
+                string extra = openSetStats(aStarState.openSet);
+                if (aStarManhattanNodes >= 0) extra += "\nWith Manhattan: " + to_string(aStarManhattanNodes);
+                extraStatsText.setString(extra);
             } else if (selectedAlgo == "Dijkstra" && dijkstraState.isComplete && selectedAlgo != "Select Algorithm") {
                 nodesVisitedText.setString("Nodes Visited: " + to_string(dijkstraState.nodesVisited));
-                pathCostText.setString("Path Cost: " + to_string(dijkstraState.pathCost));
+                pathCostText.setString("Path Cost: " + formatCost(dijkstraState.pathCost, dijkstraState.move.straight));
+                extraStatsText.setString(openSetStats(dijkstraState.openSet));
+            } else if ((selectedAlgo == "JPS" && jpsState.isComplete) || (selectedAlgo == "JPS+" && jpsPlusState.isComplete)) {
+                const JPSState& jps = (selectedAlgo == "JPS") ? jpsState : jpsPlusState;
+                nodesVisitedText.setString("Nodes Visited: " + to_string(jps.nodesVisited));
+                pathCostText.setString("Path Cost: " + formatCost(jps.pathCost, jps.move.straight));
+                if (!jps.noPathExists) extraStatsText.setString("A* Nodes Visited: " + to_string(jpsAStarNodes));
+            } else if (selectedAlgo == "Bidirectional BFS" && biBfsState.isComplete) {
+                // The combined count, then how it splits between the two halves.
+                nodesVisitedText.setString("Nodes Visited: " + to_string(biBfsState.nodesVisited));
+                pathCostText.setString("Path Cost: " + to_string(biBfsState.pathCost));
+                extraStatsText.setString("Forward: " + to_string(biBfsState.forward.expanded) +
+                                         "  Backward: " + to_string(biBfsState.backward.expanded));
+            } else if (selectedAlgo == "Bidirectional A*" && biAStarState.isComplete) {
+                nodesVisitedText.setString("Nodes Visited: " + to_string(biAStarState.nodesVisited));
+                pathCostText.setString("Path Cost: " + formatCost(biAStarState.pathCost, biAStarState.move.straight));
+                extraStatsText.setString("Forward: " + to_string(biAStarState.forward.expanded) +
+                                         "  Backward: " + to_string(biAStarState.backward.expanded));
+            } else if (selectedAlgo == "LPA*" && lpaState.isComplete) {
+                // After an edit, compare the cells the repair touched with a full replan.
+                nodesVisitedText.setString("Nodes Visited: " + to_string(lpaState.nodesVisited));
+                pathCostText.setString("Path Cost: " + formatCost(lpaState.pathCost, lpaState.move.straight));
+                string touched = "Touched: " + to_string(lpaState.nodesTouched);
+                if (lpaState.isRepair) touched += " (full: " + to_string(lpaFullTouched) + ")";
+                extraStatsText.setString(touched);
+            } else if (selectedAlgo == "HPA*" && hpaState.isComplete) {
+                // Nodes of the cluster graph the search expanded vs. cells expanded refining its path.
+                nodesVisitedText.setString("Nodes Visited: " + to_string(hpaState.nodesVisited));
+                pathCostText.setString("Path Cost: " + formatCost(hpaState.pathCost, hpaState.move.straight));
+                extraStatsText.setString("Abstract: " + to_string(hpaState.abstractExpanded) +
+                                         "  Concrete: " + to_string(hpaState.concreteExpanded));
+            } else if (selectedAlgo == "Bitboard BFS" && bitBfsState.isComplete) {
+                // Cells reached, and how much word-level work the levels took.
+                nodesVisitedText.setString("Nodes Visited: " + to_string(bitBfsState.nodesVisited));
+                pathCostText.setString("Path Cost: " + to_string(bitBfsState.pathCost));
+                extraStatsText.setString("Levels: " + to_string(bitBfsState.level) + "  Words: " +
+                                         to_string(bitBfsState.wordsSwept) +
+                                         (bitBfsState.usedSIMD ? "\nSwept with AVX2" : "\nSwept 64 bits at a time"));
+            } else if (selectedAlgo == "Parallel BFS" && parallelBfsState.isComplete) {
+                // The whole reachable map gets a distance, so this counts every cell reached.
+                nodesVisitedText.setString("Nodes Visited: " + to_string(parallelBfsState.nodesVisited));
+                pathCostText.setString("Path Cost: " + to_string(parallelBfsState.pathCost));
+                extraStatsText.setString("Levels: " + to_string(parallelBfsState.level) +
+                                         "  Threads: " + to_string(parallelBfsState.pool->size()) +
+                                         "\nTop-down: " + to_string(parallelBfsState.topDownLevels) +
+                                         "  Bottom-up: " + to_string(parallelBfsState.bottomUpLevels));
+            } else if (selectedAlgo == "Delta-Stepping" && deltaState.isComplete) {
+                // Cells settled, and how many buckets and light rounds that took.
+                nodesVisitedText.setString("Nodes Visited: " + to_string(deltaState.nodesVisited));
+                pathCostText.setString("Path Cost: " + formatCost(deltaState.pathCost, deltaState.move.straight));
+                extraStatsText.setString("Buckets: " + to_string(deltaState.bucketsSettled) +
+                                         "  Rounds: " + to_string(deltaState.rounds) +
+                                         "\nRelaxations: " + to_string(deltaState.relaxations) +
+                                         "  Threads: " + to_string(deltaState.pool->size()));
+            } else if (selectedAlgo == "Flow Field" && flowState.isComplete) {
+                // The start is just one agent: its cost is read off the field, wherever it is moved.
+                int start = pathfindingGrid.model.startIndex;
+                int startCost = start >= 0 ? flowState.cost[start] : FLOW_UNREACHED;
+                nodesVisitedText.setString("Nodes Visited: " + to_string(flowState.nodesVisited));
+                pathCostText.setString("Path Cost: " + (startCost == FLOW_UNREACHED ? string("none")
+                                                                                     : formatCost(startCost, flowState.move.straight)));
+                extraStatsText.setString("Reachable: " + to_string(flowState.reachable) + "\nLast update: " +
+                                         to_string(flowState.lastUpdateCells) + " cells" +
+                                         (flowState.lastUpdateIncremental ? " (incremental)" : ""));
+            } else if (showingCachedResult && !pathfindingGrid.model.searchCells.empty() &&
+                       searchKey(pathfindingGrid.model, selectedAlgo, isDiagonal, heuristicKind, queueKind) == shownSearch) {
+                // A search replayed from the cache: its state was never run, so show what it
+                // showed when it was first solved.
+                searchComplete = false;
+                nodesVisitedText.setString("Nodes Visited: " + to_string(shownResult.nodesVisited));
+                pathCostText.setString("Path Cost: " + shownResult.costText);
+                string extra = shownResult.extraText.empty() ? "" : shownResult.extraText + "\n";
+                extraStatsText.setString(extra + "From the cache (" + to_string(resultCache.hits) + " hits, " +
+                                         to_string(resultCache.size()) + " stored)");
             } else{
                 // If no search is complete, show the default "0" values.
+                searchComplete = false;
                 nodesVisitedText.setString("Nodes Visited: 0");
                 pathCostText.setString("Path Cost: 0");
             }
+
+            // 3. A search that missed the cache has just finished: remember it, unless the
+            //    map, the start or the end was changed while it was paused.
+            if (storeRunningSearch && searchComplete) {
+                storeRunningSearch = false;
+                if (searchKey(pathfindingGrid.model, selectedAlgo, isDiagonal, heuristicKind, queueKind) == runningSearch) {
+                    CachedSearch result;
+                    captureSearch(pathfindingGrid.model, result);
+                    if (selectedAlgo == "BFS") copyCounters(bfsState, result);
+                    else if (selectedAlgo == "DFS") copyCounters(dfsState, result);
+                    else if (selectedAlgo == "A* Search") copyCounters(aStarState, result);
+                    else if (selectedAlgo == "Dijkstra") copyCounters(dijkstraState, result);
+                    else if (selectedAlgo == "JPS") copyCounters(jpsState, result);
+                    else if (selectedAlgo == "JPS+") copyCounters(jpsPlusState, result);
+                    else if (selectedAlgo == "Bidirectional BFS") copyCounters(biBfsState, result);
+                    else if (selectedAlgo == "Bidirectional A*") copyCounters(biAStarState, result);
+                    else if (selectedAlgo == "LPA*") copyCounters(lpaState, result);
+                    else if (selectedAlgo == "HPA*") copyCounters(hpaState, result);
+                    else if (selectedAlgo == "Bitboard BFS") copyCounters(bitBfsState, result);
+                    else if (selectedAlgo == "Parallel BFS") copyCounters(parallelBfsState, result);
+                    else if (selectedAlgo == "Delta-Stepping") copyCounters(deltaState, result);
+                    result.costText = string(pathCostText.getString()).substr(string("Path Cost: ").size());
+                    result.extraText = string(extraStatsText.getString());
+                    resultCache.store(runningSearch, std::move(result));
+                }
+            }
         }
 
        // This is the final part of the UPDATE LOGIC section.
@@ -1598,6 +2113,11 @@ int main()
         }else {// Pathfinding Mode
             // Draw the main pathfinding grid and the control panel background.
             pathfindingGrid.draw(window);
+            if (string(algorithmDropdown.selected.getString()) == "HPA*") {
+                pathfindingGrid.drawClusterBorders(window, hpaState.clusterSize);
+            } else if (string(algorithmDropdown.selected.getString()) == "Flow Field") {
+                pathfindingGrid.drawFlowField(window, flowState);
+            }
             for (auto &bar : controlBars) window.draw(bar);
 
             // Dynamically reposition the control buttons for this mode.
@@ -1617,6 +2137,7 @@ int main()
             window.draw(pathClearBtn.label);
             window.draw(mazeGenBtn.shape);
             window.draw(mazeGenBtn.label);
+            window.draw(mazeKindLabel);
             window.draw(sliderTrack);
             window.draw(sliderFill);
             window.draw(sliderKnob); 
@@ -1671,12 +2192,15 @@ int main()
             }
 
             // --- Draw Statistics Panels (if pseudocode is hidden) ---
-            // The stats panels are hidden when pseudocode is visible to prevent overlap.
-            if (currentMode == Mode::Pathfinding && !showPseudocode) {
+            // The stats panels are hidden when pseudocode is visible to prevent overlap,
+            // and while the (now longer) pathfinding dropdown is open over them.
+            if (currentMode == Mode::Pathfinding && !showPseudocode && !algorithmDropdown.expanded) {
                 window.draw(statsTitle);
                 window.draw(statsAlgoNameText);
                 window.draw(nodesVisitedText);
                 window.draw(pathCostText);
+                window.draw(extraStatsText);
+                if (algorithmDropdown.selected.getString() == "A* Search") window.draw(heuristicLabel);
             }
 
             if (currentMode == Mode::Sorting && !showPseudocode) {
@@ -1713,6 +2237,9 @@ int main()
             window.draw(startlabel);
             window.draw(diagonalBox);
             window.draw(diagonalLabel);
+            if(selectAlgo == "A* Search" || selectAlgo == "Dijkstra"){
+                window.draw(queueLabel);
+            }
             if(selectAlgo == "A* Search"){
                 window.draw(osetbox);
                 window.draw(osetlabel);
@@ -1723,6 +2250,27 @@ int main()
                 window.draw(osetlabel);
                 window.draw(mudbox);
                 window.draw(mudlabel);   
+            }else if(selectAlgo == "JPS" || selectAlgo == "JPS+"){
+                window.draw(osetbox);
+                window.draw(osetlabel);
+            }else if(selectAlgo == "Bidirectional BFS"){
+                window.draw(backbox);
+                window.draw(backlabel);
+            }else if(selectAlgo == "LPA*" || selectAlgo == "HPA*" || selectAlgo == "Delta-Stepping"){
+                window.draw(osetbox);
+                window.draw(osetlabel);
+                window.draw(mudbox);
+                window.draw(mudlabel);
+            }else if(selectAlgo == "Flow Field"){
+                window.draw(mudbox);
+                window.draw(mudlabel);
+            }else if(selectAlgo == "Bidirectional A*"){
+                window.draw(osetbox);
+                window.draw(osetlabel);
+                window.draw(mudbox);
+                window.draw(mudlabel);
+                window.draw(backbox);
+                window.draw(backlabel);
             }
             
         }
@@ -1745,6 +2293,16 @@ int main()
                 else if (selectedAlgo == "DFS") activeLine = dfsState.currentLine;
                 else if (selectedAlgo == "A* Search") activeLine = aStarState.currentLine;
                 else if (selectedAlgo == "Dijkstra") activeLine = dijkstraState.currentLine;
+                else if (selectedAlgo == "JPS") activeLine = jpsState.currentLine;
+                else if (selectedAlgo == "JPS+") activeLine = jpsPlusState.currentLine;
+                else if (selectedAlgo == "Bidirectional BFS") activeLine = biBfsState.currentLine;
+                else if (selectedAlgo == "Bidirectional A*") activeLine = biAStarState.currentLine;
+                else if (selectedAlgo == "LPA*") activeLine = lpaState.currentLine;
+                else if (selectedAlgo == "HPA*") activeLine = hpaState.currentLine;
+                else if (selectedAlgo == "Bitboard BFS") activeLine = bitBfsState.currentLine;
+                else if (selectedAlgo == "Parallel BFS") activeLine = parallelBfsState.currentLine;
+                else if (selectedAlgo == "Delta-Stepping") activeLine = deltaState.currentLine;
+                else if (selectedAlgo == "Flow Field") activeLine = flowState.currentLine;
 
                 auto& lines = pseudoManager.pseudocodes[selectedAlgo];
                 for (size_t i = 0; i < lines.size(); ++i) {
@@ -0,0 +1,484 @@
+// ===================================================================================
+// FILE: pathbench.cpp
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: A headless command-line runner for the pathfinding algorithms. It
+// builds a grid (open, or random walls and weights or a DFS maze from a fixed seed)
+// or loads a Moving AI map, picks its queries (random open start/end pairs,
+// or the queries of a .scen file), runs every selected algorithm to completion on
+// each query without drawing anything, and writes one CSV row or JSON object per
+// query and algorithm:
+//
+//   wall-clock time, nodes expanded, peak open-set size, path cost, bytes allocated
+//
+// Each query runs twice. The first run is timed and counts the bytes allocated
+// (every operator new in the process is counted, worker threads included). The
+// second, untimed run measures the open set's size after every step, so sampling
+// it does not slow down the timed run. An algorithm keeps its state from query to
+// query, the way the visualizer reuses it, so the first query pays for allocating
+// the per-cell arrays and later ones show the steady state. It only depends on the
+// render-free GridModel, so SFML is not needed:
+//
+//   g++ -std=c++17 -O2 pathbench.cpp src/GridModel.cpp src/LivePath.cpp src/BFS.cpp src/DFS.cpp
+//       src/Astar.cpp src/Dijkstra.cpp src/JPS.cpp src/Bidirectional.cpp
+//       src/LPAStar.cpp src/HPA.cpp src/MonotoneQueue.cpp src/Landmarks.cpp
+//       src/MazeGenerator.cpp src/BitBFS.cpp src/WorkerPool.cpp src/ParallelBFS.cpp
+//       src/DeltaStepping.cpp src/Connectivity.cpp src/MovingAI.cpp -pthread -o pathbench
+//   ./pathbench [options]     (./pathbench --help lists them)
+// ===================================================================================
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+#include "src/GridModel.h"
+#include "src/BFS.h"
+#include "src/DFS.h"
+#include "src/Astar.h"
+#include "src/Dijkstra.h"
+#include "src/JPS.h"
+#include "src/Bidirectional.h"
+#include "src/LPAStar.h"
+#include "src/HPA.h"
+#include "src/BitBFS.h"
+#include "src/ParallelBFS.h"
+#include "src/DeltaStepping.h"
+#include "src/MazeGenerator.h"
+#include "src/MovingAI.h"
+
+// ===================================================================================
+// == Allocation Counting ==
+// ===================================================================================
+// Every allocation in the process goes through these, so the runner can read how
+// many bytes a query asked for.
+
+static std::atomic<long long> bytesAllocated{0};
+
+void* operator new(std::size_t size) {
+    bytesAllocated.fetch_add(static_cast<long long>(size), std::memory_order_relaxed);
+    if (void* block = std::malloc(size ? size : 1)) return block;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) { return operator new(size); }
+// GCC cannot see that the replaced operator new above is malloc, and warns about
+// freeing what it returned.
+#if defined(__GNUC__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* block) noexcept { std::free(block); }
+void operator delete[](void* block) noexcept { std::free(block); }
+void operator delete(void* block, std::size_t) noexcept { std::free(block); }
+void operator delete[](void* block, std::size_t) noexcept { std::free(block); }
+#if defined(__GNUC__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+// ===================================================================================
+// == Open-Set Sizes ==
+// ===================================================================================
+// How many cells each algorithm has waiting to be expanded, read between steps.
+
+std::size_t openSetSize(const BFSState& s) { return s.queue.size() - s.queueHead; }
+std::size_t openSetSize(const DFSState& s) { return s.stack.size(); }
+std::size_t openSetSize(const AStarState& s) { return s.openSet.size(); }
+std::size_t openSetSize(const DijkstraState& s) { return s.openSet.size(); }
+std::size_t openSetSize(const JPSState& s) { return s.openSet.size(); }
+std::size_t openSetSize(const BidirectionalBFSState& s) {
+    return (s.forward.queue.size() - s.forward.head) + (s.backward.queue.size() - s.backward.head);
+}
+std::size_t openSetSize(const BidirectionalAStarState& s) { return s.forward.openSet.size() + s.backward.openSet.size(); }
+std::size_t openSetSize(const LPAState& s) { return s.openSet.size(); }
+std::size_t openSetSize(const HPAState& s) { return s.openSet.size(); }
+std::size_t openSetSize(const ParallelBFSState& s) { return s.frontier.size(); }
+std::size_t openSetSize(const DeltaSteppingState& s) { return static_cast<std::size_t>(s.queued); }
+static inline int popCount(std::uint64_t bits) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(bits);
+#else
+    int count = 0;
+    for (; bits; bits &= bits - 1) count++;
+    return count;
+#endif
+}
+
+std::size_t openSetSize(const BitBFSState& s) {
+    std::size_t cells = 0;
+    for (std::uint64_t word : s.frontier) cells += popCount(word);
+    return cells;
+}
+
+// ===================================================================================
+// == Running a Query ==
+// ===================================================================================
+
+struct QueryResult {
+    double seconds = 0.0;
+    int nodesExpanded = 0;
+    std::size_t peakOpen = 0;
+    int pathCost = 0;
+    long long bytes = 0;
+    bool found = false;
+};
+
+/**
+ * @brief Runs one query to completion twice: timed, then sampling the open set.
+ * @param grid The grid, with the query's start and end placed.
+ * @param state The algorithm's state, kept between queries.
+ * @param start A callable that seeds the state with the grid's start cell.
+ * @param step A callable that performs a single algorithm step.
+ * @param isDiagonal Whether diagonal moves are allowed.
+ */
+template <typename State, typename StartFn, typename StepFn>
+QueryResult runQuery(GridModel& grid, State& state, StartFn start, StepFn step, bool isDiagonal) {
+    QueryResult result;
+    grid.clearPath();
+    long long bytesBefore = bytesAllocated.load();
+    auto begin = std::chrono::steady_clock::now();
+    start(grid, state);
+    while (!state.isComplete) step(grid, state, isDiagonal);
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    result.bytes = bytesAllocated.load() - bytesBefore;
+    result.nodesExpanded = state.nodesVisited;
+    result.pathCost = state.pathCost;
+    result.found = !state.noPathExists;
+
+    grid.clearPath();
+    start(grid, state);
+    result.peakOpen = openSetSize(state);
+    while (!state.isComplete) {
+        step(grid, state, isDiagonal);
+        result.peakOpen = std::max(result.peakOpen, openSetSize(state));
+    }
+    grid.clearPath();
+    return result;
+}
+
+/**
+ * @brief The state of every algorithm, kept for the whole run and set up headless.
+ */
+struct AlgorithmStates {
+    BFSState bfs;
+    DFSState dfs;
+    AStarState aStar;
+    DijkstraState dijkstra;
+    JPSState jps;
+    JPSState jpsPlus;
+    BidirectionalBFSState biBfs;
+    BidirectionalAStarState biAStar;
+    LPAState lpa;
+    HPAState hpa;
+    BitBFSState bitBfs;
+    ParallelBFSState parallelBfs;
+    DeltaSteppingState delta;
+
+    explicit AlgorithmStates(int threads) {
+        bfs.drawLivePath = dfs.drawLivePath = aStar.drawLivePath = dijkstra.drawLivePath = false;
+        jps.drawLivePath = jpsPlus.drawLivePath = false;
+        jps.paintScans = jpsPlus.paintScans = false;
+        biBfs.drawLivePath = biAStar.drawLivePath = lpa.drawLivePath = hpa.drawLivePath = false;
+        bitBfs.paintCells = parallelBfs.paintCells = delta.paintCells = false;
+        parallelBfs.threads = delta.threads = threads;
+    }
+};
+
+const char* const ALGORITHMS[] = {"bfs", "dfs", "astar", "dijkstra", "jps", "jps+", "bibfs",
+                                  "biastar", "lpa", "hpa", "bitbfs", "parbfs", "delta"};
+
+/**
+ * @brief Runs one query with the algorithm called 'name'.
+ */
+QueryResult runAlgorithm(const std::string& name, GridModel& grid, AlgorithmStates& s, bool diagonal) {
+    if (name == "bfs") return runQuery(grid, s.bfs, startBFS, bfsStep, diagonal);
+    if (name == "dfs") return runQuery(grid, s.dfs, startDFS, dfsStep, diagonal);
+    if (name == "astar") {
+        return runQuery(grid, s.aStar, [diagonal](GridModel& g, AStarState& st) { startAStar(g, st, diagonal); },
+                        aStarStep, diagonal);
+    }
+    if (name == "dijkstra") {
+        return runQuery(grid, s.dijkstra, [diagonal](GridModel& g, DijkstraState& st) { startDijkstra(g, st, diagonal); },
+                        dijkstraStep, diagonal);
+    }
+    if (name == "jps") {
+        return runQuery(grid, s.jps, [diagonal](GridModel& g, JPSState& st) { startJPS(g, st, diagonal); },
+                        jpsStep, diagonal);
+    }
+    if (name == "jps+") {
+        return runQuery(grid, s.jpsPlus, [diagonal](GridModel& g, JPSState& st) { startJPS(g, st, diagonal); },
+                        jpsPlusStep, diagonal);
+    }
+    if (name == "bibfs") return runQuery(grid, s.biBfs, startBidirectionalBFS, bidirectionalBFSStep, diagonal);
+    if (name == "biastar") {
+        return runQuery(grid, s.biAStar,
+                        [diagonal](GridModel& g, BidirectionalAStarState& st) { startBidirectionalAStar(g, st, diagonal); },
+                        bidirectionalAStarStep, diagonal);
+    }
+    if (name == "lpa") {
+        return runQuery(grid, s.lpa, [diagonal](GridModel& g, LPAState& st) { startLPA(g, st, diagonal); },
+                        lpaStep, diagonal);
+    }
+    if (name == "hpa") {
+        return runQuery(grid, s.hpa, [diagonal](GridModel& g, HPAState& st) { startHPA(g, st, diagonal); },
+                        hpaStep, diagonal);
+    }
+    if (name == "bitbfs") return runQuery(grid, s.bitBfs, startBitBFS, bitBFSStep, diagonal);
+    if (name == "parbfs") return runQuery(grid, s.parallelBfs, startParallelBFS, parallelBFSStep, diagonal);
+    return runQuery(grid, s.delta, [diagonal](GridModel& g, DeltaSteppingState& st) { startDeltaStepping(g, st, diagonal); },
+                    deltaSteppingStep, diagonal);
+}
+
+// ===================================================================================
+// == Grids and Queries ==
+// ===================================================================================
+
+struct Options {
+    std::string mapPath;           // Load this Moving AI map instead of generating one.
+    std::string scenPath;          // Take the queries (and map, if none is given) from here.
+    std::string layout = "random"; // Generated grids: open, random or maze.
+    int size = 512;                // Generated grids are size x size.
+    int wallPercent = 20;          // Random grids: chance of a wall per cell.
+    int weightPercent = 0;         // Random grids: chance of a weight per open cell.
+    int queries = 10;              // Random start/end pairs (ignored with --scen).
+    unsigned seed = 1;
+    bool diagonal = false;
+    int threads = 1;               // Workers for the parallel searches (0 = one per core).
+    std::string format = "csv";
+    std::string outPath;           // Write here instead of stdout.
+    std::vector<std::string> algorithms;
+};
+
+void printUsage() {
+    std::printf(
+        "Usage: pathbench [options]\n"
+        "  --layout open|random|maze  generated grid (default random)\n"
+        "  --size N                   generated grid is N x N (default 512)\n"
+        "  --walls P --weights P      random grid: percent of walls / weights (default 20 / 0)\n"
+        "  --map FILE                 load a Moving AI .map instead\n"
+        "  --scen FILE                run the queries of a .scen file (its map unless --map)\n"
+        "  --queries K                random start/end pairs (default 10)\n"
+        "  --seed S                   seed for the grid and the queries (default 1)\n"
+        "  --diagonal                 allow diagonal moves\n"
+        "  --threads N                workers for parbfs and delta (default 1, 0 = one per core)\n"
+        "  --algo a,b,...             any of bfs dfs astar dijkstra jps jps+ bibfs biastar lpa hpa\n"
+        "                             bitbfs parbfs delta (default all)\n"
+        "  --format csv|json          output format (default csv)\n"
+        "  --out FILE                 write to FILE instead of stdout\n");
+}
+
+/**
+ * @brief Reads the command line. Returns false (after printing why) if it is bad.
+ */
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool missingValue = false;
+        auto value = [&]() -> const char* {
+            if (i + 1 >= argc) {
+                std::fprintf(stderr, "%s needs a value\n", arg.c_str());
+                missingValue = true;
+                return nullptr;
+            }
+            return argv[++i];
+        };
+        const char* v = nullptr;
+        if (arg == "--help") {
+            printUsage();
+            std::exit(0);
+        } else if (arg == "--diagonal") {
+            options.diagonal = true;
+        } else if (arg == "--layout" && (v = value())) {
+            options.layout = v;
+        } else if (arg == "--size" && (v = value())) {
+            options.size = std::atoi(v);
+        } else if (arg == "--walls" && (v = value())) {
+            options.wallPercent = std::atoi(v);
+        } else if (arg == "--weights" && (v = value())) {
+            options.weightPercent = std::atoi(v);
+        } else if (arg == "--map" && (v = value())) {
+            options.mapPath = v;
+        } else if (arg == "--scen" && (v = value())) {
+            options.scenPath = v;
+        } else if (arg == "--queries" && (v = value())) {
+            options.queries = std::atoi(v);
+        } else if (arg == "--seed" && (v = value())) {
+            options.seed = static_cast<unsigned>(std::strtoul(v, nullptr, 10));
+        } else if (arg == "--threads" && (v = value())) {
+            options.threads = std::atoi(v);
+        } else if (arg == "--format" && (v = value())) {
+            options.format = v;
+        } else if (arg == "--out" && (v = value())) {
+            options.outPath = v;
+        } else if (arg == "--algo" && (v = value())) {
+            std::string list = v;
+            for (std::size_t from = 0; from <= list.size();) {
+                std::size_t comma = list.find(',', from);
+                if (comma == std::string::npos) comma = list.size();
+                options.algorithms.push_back(list.substr(from, comma - from));
+                from = comma + 1;
+            }
+        } else {
+            if (!missingValue) std::fprintf(stderr, "unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+
+    if (options.algorithms.empty()) options.algorithms.assign(std::begin(ALGORITHMS), std::end(ALGORITHMS));
+    for (const std::string& name : options.algorithms) {
+        bool known = false;
+        for (const char* algorithm : ALGORITHMS) known = known || name == algorithm;
+        if (!known) {
+            std::fprintf(stderr, "unknown algorithm %s\n", name.c_str());
+            return false;
+        }
+    }
+    if (options.layout != "open" && options.layout != "random" && options.layout != "maze") {
+        std::fprintf(stderr, "unknown layout %s\n", options.layout.c_str());
+        return false;
+    }
+    if (options.format != "csv" && options.format != "json") {
+        std::fprintf(stderr, "unknown format %s\n", options.format.c_str());
+        return false;
+    }
+    if (options.size < 2 || options.queries < 1) {
+        std::fprintf(stderr, "--size must be at least 2 and --queries at least 1\n");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Fills the grid with the generated layout.
+ */
+void buildGrid(GridModel& grid, const Options& options, std::mt19937& rng) {
+    grid.resize(options.size, options.size);
+    if (options.layout == "random") {
+        std::uniform_int_distribution<int> percent(0, 99);
+        for (int i = 0; i < grid.size(); ++i) {
+            if (percent(rng) < options.wallPercent) grid.setType(i, NodeType::Wall);
+            else if (percent(rng) < options.weightPercent) grid.setType(i, NodeType::Weight);
+        }
+    } else if (options.layout == "maze") {
+        grid.fillWithWalls();
+        MazeGeneratorState carver;
+        startMaze(grid, carver, 0, options.seed);
+        while (carver.isGenerating) mazeStep(grid, carver);
+        grid.finalizeMaze();
+    }
+}
+
+/**
+ * @brief Picks 'count' random start/end pairs among the open cells.
+ */
+std::vector<MovingAIScenario> randomQueries(const GridModel& grid, int count, std::mt19937& rng) {
+    std::vector<int> open;
+    for (int i = 0; i < grid.size(); ++i) {
+        if (grid.types[i] == NodeType::Empty) open.push_back(i);
+    }
+    std::vector<MovingAIScenario> queries;
+    if (open.size() < 2) return queries;
+    std::uniform_int_distribution<std::size_t> pick(0, open.size() - 1);
+    for (int q = 0; q < count; ++q) {
+        int start = open[pick(rng)];
+        int end;
+        do end = open[pick(rng)]; while (end == start);
+        MovingAIScenario query;
+        query.startX = grid.colOf(start);
+        query.startY = grid.rowOf(start);
+        query.goalX = grid.colOf(end);
+        query.goalY = grid.rowOf(end);
+        queries.push_back(query);
+    }
+    return queries;
+}
+
+// Escapes a string for a JSON string literal (Windows paths have backslashes).
+std::string jsonEscape(const std::string& text) {
+    std::string escaped;
+    for (char ch : text) {
+        if (ch == '"' || ch == '\\') escaped += '\\';
+        escaped += ch;
+    }
+    return escaped;
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    // --- Grid and Queries ---
+    std::mt19937 rng(options.seed);
+    GridModel grid(1, 1);
+    std::vector<MovingAIScenario> queries;
+    std::string error;
+    std::string gridName;
+    if (!options.scenPath.empty() && !loadMovingAIScenarios(options.scenPath, queries, error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    if (options.mapPath.empty() && !queries.empty()) {
+        // The map named in the scenarios, looked for next to the .scen file.
+        std::string name = queries[0].map.substr(queries[0].map.find_last_of("/\\") + 1);
+        std::size_t slash = options.scenPath.find_last_of("/\\");
+        options.mapPath = (slash == std::string::npos ? std::string() : options.scenPath.substr(0, slash + 1)) + name;
+    }
+    if (!options.mapPath.empty()) {
+        if (!loadMovingAIMap(options.mapPath, grid, error)) {
+            std::fprintf(stderr, "%s\n", error.c_str());
+            return 1;
+        }
+        gridName = options.mapPath;
+    } else {
+        buildGrid(grid, options, rng);
+        gridName = options.layout + "-" + std::to_string(options.size);
+    }
+    if (queries.empty()) queries = randomQueries(grid, options.queries, rng);
+
+    // --- Output ---
+    FILE* out = options.outPath.empty() ? stdout : std::fopen(options.outPath.c_str(), "w");
+    if (!out) {
+        std::fprintf(stderr, "cannot write %s\n", options.outPath.c_str());
+        return 1;
+    }
+    bool json = options.format == "json";
+    if (json) {
+        std::fprintf(out, "{\n  \"grid\": \"%s\", \"rows\": %d, \"cols\": %d, \"seed\": %u, \"diagonal\": %s,\n  \"results\": [",
+                     jsonEscape(gridName).c_str(), grid.rows, grid.cols, options.seed, options.diagonal ? "true" : "false");
+    } else {
+        std::fprintf(out, "algorithm,grid,query,start_row,start_col,end_row,end_col,diagonal,seconds,"
+                          "nodes_expanded,peak_open,path_cost,bytes_allocated,found\n");
+    }
+
+    AlgorithmStates states(options.threads);
+    bool first = true;
+    for (const std::string& name : options.algorithms) {
+        for (std::size_t q = 0; q < queries.size(); ++q) {
+            const MovingAIScenario& query = queries[q];
+            if (!placeScenario(grid, query)) continue;
+            QueryResult r = runAlgorithm(name, grid, states, options.diagonal);
+            if (json) {
+                std::fprintf(out, "%s\n    {\"algorithm\": \"%s\", \"query\": %zu, \"start\": [%d, %d], \"end\": [%d, %d], "
+                                  "\"seconds\": %.9f, \"nodes_expanded\": %d, \"peak_open\": %zu, \"path_cost\": %d, "
+                                  "\"bytes_allocated\": %lld, \"found\": %s}",
+                             first ? "" : ",", name.c_str(), q, query.startY, query.startX, query.goalY, query.goalX,
+                             r.seconds, r.nodesExpanded, r.peakOpen, r.pathCost, r.bytes, r.found ? "true" : "false");
+            } else {
+                std::fprintf(out, "%s,%s,%zu,%d,%d,%d,%d,%d,%.9f,%d,%zu,%d,%lld,%d\n", name.c_str(), gridName.c_str(), q,
+                             query.startY, query.startX, query.goalY, query.goalX, options.diagonal ? 1 : 0, r.seconds,
+                             r.nodesExpanded, r.peakOpen, r.pathCost, r.bytes, r.found ? 1 : 0);
+            }
+            first = false;
+        }
+    }
+    if (json) std::fprintf(out, "\n  ]\n}\n");
+    if (out != stdout) std::fclose(out);
+    return 0;
+}
@@ -6,22 +6,34 @@
 // DESCRIPTION: Implements the step-by-step logic for the A* pathfinding algorithm.
 // ===================================================================================
 
-#include "AStar.h"
-#include <cmath> // For heuristic calculation (abs)
+#include "Astar.h"
+#include <algorithm>
 #include <limits> // For infinity
 
 /**
- * @brief Calculates the Manhattan distance heuristic between two nodes.
- * @param a The starting node.
- * @param b The ending node.
+ * @brief Calculates the heuristic distance between two cells.
+ * @param grid The grid model the cells belong to.
+ * @param a The index of the starting cell.
+ * @param b The index of the ending cell.
+ * @param kind The distance estimate to use (see Heuristics.h).
+ * @param move The step costs the estimate is expressed in.
  * @return The H-cost, an integer estimate of the distance.
  */
-int calculateHeuristic(Node* a, Node* b) {
-    return std::abs(a->row - b->row) + std::abs(a->col - b->col);
+int calculateHeuristic(const GridModel& grid, int a, int b, HeuristicKind kind, MoveCosts move) {
+    return heuristicCost(kind, grid.rowOf(a) - grid.rowOf(b), grid.colOf(a) - grid.colOf(b), move);
 }
 
-void drawCurrentAStarPath(Grid& grid, Node* currentNode, std::map<Node*, Node*>& parentMap);
-
+/**
+ * @brief The H-cost of a cell under the run's heuristic. The ALT bound and the octile
+ * estimate are both admissible and consistent, so their maximum is too.
+ */
+int calculateHeuristic(const GridModel& grid, const AStarState& state, int cell) {
+    int hCost = calculateHeuristic(grid, cell, grid.endIndex, state.activeHeuristic, state.move);
+    if (state.activeHeuristic == HeuristicKind::Landmarks) {
+        hCost = std::max(hCost, landmarkHeuristic(state.landmarks, cell, grid.endIndex));
+    }
+    return hCost;
+}
 
 /**
  * @brief Performs a single step of the A* search algorithm.
@@ -30,11 +42,13 @@ void drawCurrentAStarPath(Grid& grid, Node* currentNode, std::map<Node*, Node*>&
  * with the lowest F-cost from the open set, evaluates its neighbors, and updates their
  * costs if a cheaper path is found.
  *
- * @param grid The main pathfinding grid (passed by reference).
+ * @param grid The pathfinding grid model.
  * @param state The current state of the A* search (passed by reference).
  * @param allowDiagonals A boolean flag to enable/disable 8-directional movement.
+ * @param canvas The grid to paint open and visited cells on, or nullptr to search
+ * without drawing.
  */
-void aStarStep(Grid& grid, AStarState& state, bool isDiagonal) {
+static void expandNext(const GridModel& grid, AStarState& state, bool isDiagonal, GridModel* canvas) {
     if (!state.isSearching || state.isComplete) return;
 
     state.currentLine = 2; // while openSet is not empty
@@ -49,15 +63,19 @@ void aStarStep(Grid& grid, AStarState& state, bool isDiagonal) {
 
     state.currentLine = 3; // current = node with lowest fCost
 
-    // 1. Get the node with the lowest F-cost from the priority queue.
-    Node* current = state.openSet.top().node;
-    state.openSet.pop();
+    // 1. Get the cell with the lowest F-cost from the priority queue.
+    int current = state.openSet.pop().node;
+
+    // Only the plain binary heap queues a cell more than once; a stale entry for a
+    // cell that is already closed is dropped without counting it. The end is never
+    // closed (the search stops on it), so it is still checked first.
+    if (state.marks.closed(current)) return;
     state.nodesVisited++; // ** NEW **
 
-    drawCurrentAStarPath(grid, current, state.parentMap);
+    if (canvas && state.drawLivePath) updateLivePath(*canvas, state.livePath, current, state.parent);
 
     state.currentLine = 4; // if current == goal
-    if (current == grid.endNode) {
+    if (current == grid.endIndex) {
         state.pathCost = state.gCost[current]; // ** NEW **
         state.isComplete = true;
         state.isSearching = false;
@@ -65,13 +83,13 @@ void aStarStep(Grid& grid, AStarState& state, bool isDiagonal) {
         return;
     }
 
-    if (current->type != NodeType::Start) {
-        current->type = NodeType::Visited;
-        current->shape.setFillColor(sf::Color(173, 216, 230));
+    state.marks.close(current);
+    if (canvas && grid.types[current] != NodeType::Start) {
+        canvas->setType(current, NodeType::Visited);
     }
 
-    int r = current->row;
-    int c = current->col;
+    int r = grid.rowOf(current);
+    int c = grid.colOf(current);
     int dr[] = {-1, 1, 0, 0, -1, -1, 1, 1};
     int dc[] = {0, 0, -1, 1, -1, 1, -1, 1};
 
@@ -83,67 +101,119 @@ void aStarStep(Grid& grid, AStarState& state, bool isDiagonal) {
         int new_r = r + dr[i];
         int new_c = c + dc[i];
 
-        if (new_r >= 0 && new_r < grid.rows && new_c >= 0 && new_c < grid.cols) {
-            Node& neighbor = grid.nodes[new_r][new_c];
+        if (grid.isValid(new_r, new_c)) {
+            int neighbor = grid.index(new_r, new_c);
+            NodeType neighborType = grid.types[neighbor];
 
-            if (neighbor.type == NodeType::Wall || neighbor.type == NodeType::Visited) {
+            // Skip walls and cells that have already been expanded (the closed set).
+            if (neighborType == NodeType::Wall || state.marks.closed(neighbor)) {
                 continue;
             }
+            if (i >= 4 && !state.move.cutCorners && grid.cutsCorner(r, c, dr[i], dc[i])) continue;
 
             state.currentLine = 8; // tentative_gCost = ...
-            // 3. Calculate the G-cost to this neighbor through the current node.
-            int tentative_gCost = state.gCost[current] + neighbor.cost;
+            // 3. Calculate the G-cost to this neighbor through the current cell. The
+            //    first four directions are straight moves, the rest diagonal ones.
+            int step = i < 4 ? state.move.straight : state.move.diagonal;
+            int tentative_gCost = state.gCost[current] + grid.costs[neighbor] * step;
 
             state.currentLine = 9; // if tentative_gCost < gCost
 
             // 4. If this path is cheaper than any previous path, update and record it.
-            if (tentative_gCost < state.gCost[&neighbor]) {
+            int neighborG = state.marks.seen(neighbor) ? state.gCost[neighbor] : std::numeric_limits<int>::max();
+            if (tentative_gCost < neighborG) {
+                state.marks.open(neighbor);
                 state.currentLine = 10; // parent[neighbor] = current
-                state.parentMap[&neighbor] = current;
+                state.parent[neighbor] = current;
                 state.currentLine = 11; // gCost[neighbor] = ...
-                state.gCost[&neighbor] = tentative_gCost;
-                int hCost = calculateHeuristic(&neighbor, grid.endNode);
+                state.gCost[neighbor] = tentative_gCost;
+                int hCost = calculateHeuristic(grid, state, neighbor);
                 int fCost = tentative_gCost + hCost;
                 state.currentLine = 12; // fCost[neighbor] = ...
-                state.openSet.push({&neighbor, fCost});
-                state.currentLine = 13; // openSet.add(neighbor)
-
-                if (neighbor.type != NodeType::End && neighbor.type != NodeType::Start) {
-                    neighbor.shape.setFillColor(sf::Color(200, 255, 200));
+                // Queues the neighbour, or lowers its F-cost if it is already queued.
+                // Equal F-costs are broken toward the smaller H, i.e. the larger G, so
+                // on open ground the search keeps pushing on along one path.
+                state.openSet.push(neighbor, fCost, hCost);
+                state.currentLine = 13; // openSet.addOrDecrease(neighbor)
+
+                if (canvas && neighborType != NodeType::End && neighborType != NodeType::Start) {
+                    canvas->setType(neighbor, NodeType::Open);
                 }
             }
         }
     }
 }
 
+void aStarStep(GridModel& grid, AStarState& state, bool isDiagonal) {
+    expandNext(grid, state, isDiagonal, &grid);
+}
+
+/**
+ * @brief Resets the A* state and seeds the open set with the grid's start cell.
+ *
+ * Only a new marker generation is started, so the cost does not depend on the
+ * grid size: unseen cells read as "infinity" through the marks, and the parent
+ * and G-cost arrays are sized once and reused by later runs.
+ */
+static void seedSearch(const GridModel& grid, AStarState& state, bool isDiagonal, bool cutCorners) {
+    resetAStar(state);
+    state.move = moveCosts(isDiagonal, cutCorners);
+    state.activeHeuristic = resolveHeuristic(state.heuristic, isDiagonal);
+    state.landmarksRebuilt = state.activeHeuristic == HeuristicKind::Landmarks &&
+                             landmarksStale(grid, state.landmarks, isDiagonal);
+    if (state.landmarksRebuilt) buildLandmarks(grid, state.landmarks, isDiagonal);
+    // A move adds at most WEIGHT_COST times its step cost to G and, even for Manhattan
+    // on a diagonal grid, two straight steps to H, which bounds how far apart the
+    // queued keys can get. The ALT bound can grow by as much as the move back costs.
+    int longestStep = isDiagonal ? state.move.diagonal : state.move.straight;
+    int hStep = state.activeHeuristic == HeuristicKind::Landmarks ? WEIGHT_COST * longestStep : 2 * state.move.straight;
+    state.openSet.reset(state.queueKind, WEIGHT_COST * longestStep + hStep, grid.size());
+    state.marks.begin(grid.size());
+    if (static_cast<int>(state.parent.size()) != grid.size()) {
+        state.parent.resize(grid.size());
+        state.gCost.resize(grid.size());
+    }
+    state.marks.open(grid.startIndex);
+    state.parent[grid.startIndex] = -1;
+    state.gCost[grid.startIndex] = 0;
+    int hCost = calculateHeuristic(grid, state, grid.startIndex);
+    state.openSet.push(grid.startIndex, hCost, hCost);
+    state.isSearching = true;
+}
+
+void startAStar(GridModel& grid, AStarState& state, bool isDiagonal, bool cutCorners) {
+    seedSearch(grid, state, isDiagonal, cutCorners);
+}
+
 void resetAStar(AStarState& state) {
     state.isSearching = false;
     state.isComplete = false;
     state.noPathExists = false;
-    state.parentMap.clear();
-    state.gCost.clear();
+    resetLivePath(state.livePath);
     state.currentLine = 0;
     state.nodesVisited = 0; // ** NEW **
     state.pathCost = 0;     // ** NEW **
-    std::priority_queue<AStarNode, std::vector<AStarNode>, std::greater<AStarNode>> empty;
-    state.openSet.swap(empty);
+    state.openSet.clear(); // Keeps the capacity for the next run.
 }
 
-void drawCurrentAStarPath(Grid& grid, Node* currentNode, std::map<Node*, Node*>& parentMap) {
-    for (int i = 0; i < grid.rows; ++i) {
-        for (int j = 0; j < grid.cols; ++j) {
-            if (grid.nodes[i][j].type == NodeType::Path) {
-                grid.nodes[i][j].type = NodeType::Visited;
-                grid.nodes[i][j].shape.setFillColor(sf::Color(173, 216, 230));
-            }
-        }
-    }
-    Node* tracer = currentNode;
-    while (tracer != grid.startNode && tracer != nullptr) {
-        if (tracer != grid.endNode) {
-            tracer->type = NodeType::Path;
-            tracer->shape.setFillColor(sf::Color::Yellow);
-        }
-        tracer = parentMap[tracer];
+int aStarNodesVisited(const GridModel& grid, bool isDiagonal, HeuristicKind heuristic, AStarComparison& comparison) {
+    if (comparison.nodesVisited >= 0 && comparison.version == grid.contentVersion() &&
+        comparison.start == grid.startIndex && comparison.end == grid.endIndex &&
+        comparison.heuristic == heuristic && comparison.isDiagonal == isDiagonal) {
+        return comparison.nodesVisited;
     }
+
+    AStarState& state = comparison.scratch;
+    state.drawLivePath = false;
+    state.heuristic = heuristic;
+    seedSearch(grid, state, isDiagonal, true);
+    while (!state.isComplete) expandNext(grid, state, isDiagonal, nullptr);
+
+    comparison.version = grid.contentVersion();
+    comparison.start = grid.startIndex;
+    comparison.end = grid.endIndex;
+    comparison.heuristic = heuristic;
+    comparison.isDiagonal = isDiagonal;
+    comparison.nodesVisited = state.nodesVisited;
+    return comparison.nodesVisited;
 }
@@ -10,53 +10,101 @@
 #ifndef ASTAR_H
 #define ASTAR_H
 
-#include "Grid.h"
+#include "GridModel.h"
+#include "Heuristics.h"
+#include "Landmarks.h"
+#include "LivePath.h"
+#include "MonotoneQueue.h"
+#include "SearchMarks.h"
+#include <cstdint>
 #include <vector>
-#include <map>
-#include <queue> // For the priority queue
-
-/**
- * @brief A node wrapper for the A* priority queue.
- *
- * Contains a pointer to a grid node and its associated F-cost (G-cost + H-cost).
- * The overloaded '>' operator allows the priority queue to function as a min-heap,
- * always providing the node with the lowest F-cost.
- */
-struct AStarNode {
-    Node* node;
-    int fCost;
-
-    // Overload the > operator for the priority queue (min-heap)
-    bool operator>(const AStarNode& other) const {
-        return fCost > other.fCost;
-    }
-};
 
 /**
  * @brief Holds all state information for an A* search in progress.
  */
 
 struct AStarState {
-    // The "open set" of nodes to be evaluated, prioritized by lowest F-cost.
-    std::priority_queue<AStarNode, std::vector<AStarNode>, std::greater<AStarNode>> openSet;
+    // The "open set" of nodes to be evaluated, keyed on F-cost. Clearing it keeps its
+    // memory for the next run.
+    MonotoneQueue openSet;
+    QueueKind queueKind = QueueKind::Auto; // The structure the next run's open set uses.
 
-    // Maps a node to the node from which it was reached. Used to reconstruct the path.
-    std::map<Node*, Node*> parentMap;
+    // The distance estimate the next run uses, and what the current run resolved it
+    // to along with its step costs (fixed point when diagonals are allowed).
+    HeuristicKind heuristic = HeuristicKind::Auto;
+    HeuristicKind activeHeuristic = HeuristicKind::Manhattan;
+    MoveCosts move = moveCosts(false);
 
-    // Maps a node to its G-cost (the known cost from the start node).
-    std::map<Node*, int> gCost; // Cost from start to node
+    // ALT tables for the Landmarks heuristic. They outlive a run and are rebuilt by
+    // startAStar() only once the walls or weights have changed.
+    LandmarkTables landmarks;
+    bool landmarksRebuilt = false; // True if the current run had to rebuild them.
+
+    // Open/closed markers for this run. A cell's parent and G-cost are only
+    // meaningful once it is seen, so nothing has to be reset between runs.
+    SearchMarks marks;
+
+    // parent[i] is the cell from which cell i was reached.
+    std::vector<int> parent;
+
+    // gCost[i] is the best known cost from the start to cell i (only valid for seen cells).
+    std::vector<int> gCost;
 
     bool isSearching = false;
     bool isComplete = false;
     bool noPathExists = false;
     int currentLine = 0;
     int nodesVisited = 0; // ** NEW **
-    int pathCost = 0;     // ** NEW **
+    int pathCost = 0;     // ** NEW ** In move.straight units per ordinary step.
+    bool drawLivePath = true; // Headless runs turn this off to skip the per-step path redraw.
+    LivePath livePath;        // The yellow path painted by the previous step.
 };
 
 // Function prototypes
-int calculateHeuristic(Node* a, Node* b);
-void aStarStep(Grid& grid, AStarState& state, bool isDiagonal);
+int calculateHeuristic(const GridModel& grid, int a, int b, HeuristicKind kind, MoveCosts move);
+int calculateHeuristic(const GridModel& grid, const AStarState& state, int cell);
+void aStarStep(GridModel& grid, AStarState& state, bool isDiagonal);
+
+/**
+ * @brief Resets the A* state and seeds the open set with the grid's start cell.
+ *
+ * Like LPA*, A* needs the connectivity up front: it picks the movement model and
+ * the heuristic that match it, and (re)builds the landmark tables if the
+ * Landmarks heuristic is selected and they are out of date.
+ * @param grid The pathfinding grid model; its startIndex and endIndex must be set.
+ * @param state The A* state object to initialize (passed by reference).
+ * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
+ * @param cutCorners Whether a diagonal may pass a wall's corner (the Moving AI
+ * scenarios forbid it).
+ */
+void startAStar(GridModel& grid, AStarState& state, bool isDiagonal, bool cutCorners = true);
 void resetAStar(AStarState& state);
 
+/**
+ * @brief An off-screen A* run used to compare another search against A*, and the
+ * query it answered, so asking the same question again costs nothing.
+ */
+struct AStarComparison {
+    AStarState scratch;           // Marks, G-costs and open set of the hidden search.
+    std::uint64_t version = 0;    // The grid's contentVersion() when it ran.
+    int start = -1, end = -1;
+    HeuristicKind heuristic = HeuristicKind::Auto;
+    bool isDiagonal = false;
+    int nodesVisited = -1;        // -1 until a search has run.
+};
+
+/**
+ * @brief Runs a complete A* search without drawing, or returns the count from the
+ * previous run if the map, start, end, heuristic and connectivity are unchanged.
+ *
+ * The search only reads the grid: painted cells are ignored, and its working
+ * arrays live in the comparison's scratch state and are reused between runs.
+ * @param grid The pathfinding grid model; its start and end must be placed.
+ * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
+ * @param heuristic The distance estimate to search with.
+ * @param comparison The cached result and scratch space (passed by reference).
+ * @return The number of nodes A* visited.
+ */
+int aStarNodesVisited(const GridModel& grid, bool isDiagonal, HeuristicKind heuristic, AStarComparison& comparison);
+
 #endif // ASTAR_H
\ No newline at end of file
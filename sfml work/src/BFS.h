@@ -11,23 +11,29 @@
 // ===================================================================================
 #ifndef BFS_H
 #define BFS_H
-#include "Grid.h"
-#include <queue>
-#include <map>
+#include "GridModel.h"
+#include "LivePath.h"
+#include "SearchMarks.h"
+#include <vector>
 
 /**
  * @brief Holds all state information for a Breadth-First Search in progress.
  *
- * This struct contains the queue for managing nodes to visit, a map to reconstruct
- * the path, and various flags and counters for controlling the visualization and
-// tracking statistics.
+ * This struct contains the queue for managing nodes to visit, generation-stamped
+ * visited markers, a parent array to reconstruct the path, and various flags and
+ * counters for controlling the visualization and tracking statistics.
  */
 struct BFSState {
-    // The core data structure for BFS, ensuring a level-by-level search.
-    std::queue<Node*> queue;
-    
-    // Maps a node to the node from which it was reached. Used to reconstruct the path.
-    std::map<Node*, Node*> parentMap;
+    // The core data structure for BFS, ensuring a level-by-level search. It is a
+    // plain vector read from 'queueHead', so its memory is reused from run to run.
+    std::vector<int> queue;
+    std::size_t queueHead = 0;
+
+    // Which cells this run has already reached. Starting a run is O(1).
+    SearchMarks marks;
+
+    // parent[i] is the cell from which cell i was reached (valid for cells marked seen).
+    std::vector<int> parent;
     
     // --- State Flags ---
     bool isSearching = false;  // True while the algorithm is actively running.
@@ -38,15 +44,27 @@ struct BFSState {
     int currentLine = 0;   // The current line of pseudocode to highlight.
     int nodesVisited = 0;  // A counter for the total number of nodes processed.
     int pathCost = 0;      // The total cost of the final path found.
+    bool drawLivePath = true; // Headless runs turn this off to skip the per-step path redraw.
+    LivePath livePath;        // The yellow path painted by the previous step.
 };
 
 /**
  * @brief Performs a single step of the BFS algorithm.
- * @param grid The main pathfinding grid (passed by reference).
+ * @param grid The pathfinding grid model (passed by reference).
  * @param state The current state of the BFS search (passed by reference).
  * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
  */
-void bfsStep(Grid& grid, BFSState& state, bool isDiagonal);
+void bfsStep(GridModel& grid, BFSState& state, bool isDiagonal);
+
+/**
+ * @brief Resets the BFS state and seeds it with the grid's start cell.
+ *
+ * Only a new marker generation is started, so the cost does not depend on the
+ * grid size; the parent array is sized once and reused by later runs.
+ * @param grid The pathfinding grid model; its startIndex must be set.
+ * @param state The BFS state object to initialize (passed by reference).
+ */
+void startBFS(GridModel& grid, BFSState& state);
 
 /**
  * @brief Resets the BFS state to its default values for a new search.
@@ -0,0 +1,344 @@
+// ===================================================================================
+// == FILE: src/Bidirectional.cpp ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Implements the step-by-step logic for Bidirectional BFS and
+// Bidirectional A*, including the two-colour frontier visualization, the live
+// path and the combined statistics.
+//
+// ===================================================================================
+#include "Bidirectional.h"
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+
+// Direction deltas in the order every algorithm uses: up, down, left, right, then diagonals.
+static const int DR[] = {-1, 1, 0, 0, -1, -1, 1, 1};
+static const int DC[] = {0, 0, -1, 1, -1, 1, -1, 1};
+
+// The octile distance in the run's step costs (Manhattan without diagonals). Every
+// cell costs at least 1, so it is a consistent lower bound on the remaining cost.
+static int heuristic(const GridModel& grid, int a, int b, MoveCosts move) {
+    return heuristicCost(HeuristicKind::Octile, grid.rowOf(a) - grid.rowOf(b), grid.colOf(a) - grid.colOf(b), move);
+}
+
+/**
+ * @brief Builds the cells of the live path into 'chain'.
+ *
+ * The forward half contributes start..forwardTip and the backward half
+ * backwardTip..end. Once the halves have met, the two tips are the cells on either
+ * side of the meeting move, so the chain is the final path.
+ */
+static void traceChain(std::vector<int>& chain, int forwardTip, const std::vector<int>& forwardParent,
+                       int backwardTip, const std::vector<int>& backwardParent) {
+    chain.clear();
+    for (int cell = forwardTip; cell != -1; cell = forwardParent[cell]) chain.push_back(cell);
+    std::reverse(chain.begin(), chain.end());
+    for (int cell = backwardTip; cell != -1; cell = backwardParent[cell]) chain.push_back(cell);
+}
+
+// Paints a cell with a frontier's marker, leaving the start and end nodes alone. An
+// open marker never hides a cell that either half has already expanded.
+static void paint(GridModel& grid, int cell, NodeType type) {
+    NodeType current = grid.types[cell];
+    if (current == NodeType::Start || current == NodeType::End || current == NodeType::Path) return;
+    bool isOpenMarker = type == NodeType::Open || type == NodeType::OpenBack;
+    if (isOpenMarker && (current == NodeType::Visited || current == NodeType::VisitedBack)) return;
+    grid.setType(cell, type);
+}
+
+// ===================================================================================
+// == Bidirectional BFS ==
+// ===================================================================================
+
+static void prepareFrontier(BFSFrontier& frontier, int cellCount, int root) {
+    frontier.marks.begin(cellCount);
+    if (static_cast<int>(frontier.parent.size()) != cellCount) {
+        frontier.parent.resize(cellCount);
+        frontier.dist.resize(cellCount);
+    }
+    frontier.queue.clear();
+    frontier.head = 0;
+    frontier.marks.open(root);
+    frontier.parent[root] = -1;
+    frontier.dist[root] = 0;
+    frontier.queue.push_back(root);
+    frontier.tip = -1;
+    frontier.expanded = 0;
+}
+
+// Ends the search: paints the best connection found, or reports that there is none.
+static void finishBFS(GridModel& grid, BidirectionalBFSState& state) {
+    state.isSearching = false;
+    state.isComplete = true;
+    if (state.bestMoves == INT_MAX) {
+        state.noPathExists = true;
+        state.currentLine = 17; // return PathNotFound
+        return;
+    }
+
+    traceChain(state.chain, state.meetForward, state.forward.parent, state.meetBackward, state.backward.parent);
+    if (state.drawLivePath) setLivePath(grid, state.livePath, state.chain);
+
+    // Like BFS, the cost is the sum over every cell on the path, start included.
+    for (int cell : state.chain) state.pathCost += grid.costs[cell];
+    state.currentLine = 5; // return PathFound
+}
+
+void bidirectionalBFSStep(GridModel& grid, BidirectionalBFSState& state, bool isDiagonal) {
+    if (!state.isSearching || state.isComplete) return;
+
+    BFSFrontier& forward = state.forward;
+    BFSFrontier& backward = state.backward;
+
+    // 1. Stop when a half runs dry, or when every connection still to be found would
+    //    have to pass through both queue fronts and so cannot be shorter.
+    state.currentLine = 3; // while Qf and Qb are not empty
+    if (forward.head == forward.queue.size() || backward.head == backward.queue.size()) {
+        finishBFS(grid, state);
+        return;
+    }
+    state.currentLine = 4; // if dist(Qf.front) + dist(Qb.front) >= best
+    if (state.bestMoves != INT_MAX &&
+        forward.dist[forward.queue[forward.head]] + backward.dist[backward.queue[backward.head]] >= state.bestMoves) {
+        finishBFS(grid, state);
+        return;
+    }
+
+    // 2. Expand the half with fewer cells waiting, which keeps the frontiers balanced.
+    state.currentLine = 6; // pick the side with the smaller queue
+    bool isForward = (forward.queue.size() - forward.head) <= (backward.queue.size() - backward.head);
+    BFSFrontier& side = isForward ? forward : backward;
+    BFSFrontier& other = isForward ? backward : forward;
+
+    state.currentLine = 7; // current = Q.dequeue()
+    int current = side.queue[side.head++];
+    side.tip = current;
+    side.expanded++;
+    state.nodesVisited++;
+
+    if (state.drawLivePath) {
+        traceChain(state.chain, forward.tip, forward.parent, backward.tip, backward.parent);
+        setLivePath(grid, state.livePath, state.chain);
+    }
+
+    // 3. Label the unvisited neighbours and look for cells the other half has reached.
+    int r = grid.rowOf(current);
+    int c = grid.colOf(current);
+    int numDirections = isDiagonal ? 8 : 4;
+    for (int i = 0; i < numDirections; ++i) {
+        int new_r = r + DR[i];
+        int new_c = c + DC[i];
+        if (!grid.isValid(new_r, new_c)) continue;
+
+        int neighbor = grid.index(new_r, new_c);
+        NodeType neighborType = grid.types[neighbor];
+        // Like BFS, only walls and weighted cells block the way.
+        if (neighborType == NodeType::Wall || neighborType == NodeType::Weight) continue;
+
+        state.currentLine = 9; // if neighbor is not visited by this side
+        if (!side.marks.seen(neighbor)) {
+            state.currentLine = 10;
+            side.marks.open(neighbor);
+            side.parent[neighbor] = current;
+            side.dist[neighbor] = side.dist[current] + 1;
+            side.queue.push_back(neighbor);
+            paint(grid, neighbor, isForward ? NodeType::Visited : NodeType::VisitedBack);
+        }
+
+        state.currentLine = 12; // if neighbor was reached by the other side
+        if (other.marks.seen(neighbor)) {
+            int moves = side.dist[current] + 1 + other.dist[neighbor];
+            if (moves < state.bestMoves) {
+                state.currentLine = 13; // best = min(...)
+                state.bestMoves = moves;
+                state.meetForward = isForward ? current : neighbor;
+                state.meetBackward = isForward ? neighbor : current;
+            }
+        }
+    }
+}
+
+void startBidirectionalBFS(GridModel& grid, BidirectionalBFSState& state) {
+    resetBidirectionalBFS(state);
+    prepareFrontier(state.forward, grid.size(), grid.startIndex);
+    prepareFrontier(state.backward, grid.size(), grid.endIndex);
+    state.isSearching = true;
+}
+
+void resetBidirectionalBFS(BidirectionalBFSState& state) {
+    state.isSearching = false;
+    state.isComplete = false;
+    state.noPathExists = false;
+    resetLivePath(state.livePath);
+    state.forward.queue.clear();
+    state.forward.head = 0;
+    state.forward.tip = -1;
+    state.forward.expanded = 0;
+    state.backward.queue.clear();
+    state.backward.head = 0;
+    state.backward.tip = -1;
+    state.backward.expanded = 0;
+    state.bestMoves = INT_MAX;
+    state.meetForward = -1;
+    state.meetBackward = -1;
+    state.currentLine = 0;
+    state.nodesVisited = 0;
+    state.pathCost = 0;
+}
+
+// ===================================================================================
+// == Bidirectional A* ==
+// ===================================================================================
+
+static void prepareFrontier(AStarFrontier& frontier, int cellCount, int root, int rootKey) {
+    frontier.marks.begin(cellCount);
+    if (static_cast<int>(frontier.parent.size()) != cellCount) {
+        frontier.parent.resize(cellCount);
+        frontier.gCost.resize(cellCount);
+    }
+    frontier.openSet.clear();
+    frontier.marks.open(root);
+    frontier.parent[root] = -1;
+    frontier.gCost[root] = 0;
+    frontier.openSet.push_back({root, rootKey});
+    frontier.tip = -1;
+    frontier.expanded = 0;
+}
+
+// Ends the search: paints the best connection found, or reports that there is none.
+static void finishAStar(GridModel& grid, BidirectionalAStarState& state) {
+    state.isSearching = false;
+    state.isComplete = true;
+    if (state.bestCost == INT_MAX) {
+        state.noPathExists = true;
+        state.currentLine = 17; // return PathNotFound
+        return;
+    }
+
+    traceChain(state.chain, state.meetForward, state.forward.parent, state.meetBackward, state.backward.parent);
+    if (state.drawLivePath) setLivePath(grid, state.livePath, state.chain);
+    state.pathCost = state.bestCost;
+    state.currentLine = 4; // return PathFound
+}
+
+void bidirectionalAStarStep(GridModel& grid, BidirectionalAStarState& state, bool isDiagonal) {
+    if (!state.isSearching || state.isComplete) return;
+
+    AStarFrontier& forward = state.forward;
+    AStarFrontier& backward = state.backward;
+
+    // 1. Stop when a half runs dry, or once the smallest keys show that no
+    //    connection through the open sets can be cheaper than the best one found.
+    state.currentLine = 2; // while openF and openB are not empty
+    if (forward.openSet.empty() || backward.openSet.empty()) {
+        finishAStar(grid, state);
+        return;
+    }
+    state.currentLine = 3; // if minKey(openF) + minKey(openB) >= 2 * best
+    if (state.bestCost != INT_MAX &&
+        static_cast<long long>(forward.openSet.front().key) + backward.openSet.front().key >= 2LL * state.bestCost) {
+        finishAStar(grid, state);
+        return;
+    }
+
+    // 2. Take the lowest-key cell from the half with the smaller open set.
+    state.currentLine = 5; // current = lowest-key node of the smaller open set
+    bool isForward = forward.openSet.size() <= backward.openSet.size();
+    AStarFrontier& side = isForward ? forward : backward;
+    AStarFrontier& other = isForward ? backward : forward;
+
+    std::pop_heap(side.openSet.begin(), side.openSet.end(), std::greater<BidirectionalNode>());
+    int current = side.openSet.back().node;
+    side.openSet.pop_back();
+    if (side.marks.closed(current)) return; // A stale entry for a cell already expanded.
+    side.marks.close(current);
+    side.tip = current;
+    side.expanded++;
+    state.nodesVisited++;
+    paint(grid, current, isForward ? NodeType::Visited : NodeType::VisitedBack);
+
+    if (state.drawLivePath) {
+        traceChain(state.chain, forward.tip, forward.parent, backward.tip, backward.parent);
+        setLivePath(grid, state.livePath, state.chain);
+    }
+
+    // The forward half moves into a neighbour and pays its cost; the backward half
+    // walks moves in reverse, so stepping back from 'current' pays current's cost.
+    int ownRoot = isForward ? grid.startIndex : grid.endIndex;
+    int otherRoot = isForward ? grid.endIndex : grid.startIndex;
+
+    // 3. Relax the neighbours and record any connection to the other half.
+    int r = grid.rowOf(current);
+    int c = grid.colOf(current);
+    int numDirections = isDiagonal ? 8 : 4;
+    for (int i = 0; i < numDirections; ++i) {
+        int new_r = r + DR[i];
+        int new_c = c + DC[i];
+        if (!grid.isValid(new_r, new_c)) continue;
+
+        int neighbor = grid.index(new_r, new_c);
+        if (grid.types[neighbor] == NodeType::Wall) continue;
+        if (i >= 4 && !state.move.cutCorners && grid.cutsCorner(r, c, DR[i], DC[i])) continue;
+
+        state.currentLine = 7; // g = gCost[current] + moveCost(current, neighbor)
+        int step = i < 4 ? state.move.straight : state.move.diagonal;
+        int g = side.gCost[current] + (isForward ? grid.costs[neighbor] : grid.costs[current]) * step;
+
+        state.currentLine = 13; // if neighbor was reached by the other side
+        if (other.marks.seen(neighbor) && g + other.gCost[neighbor] < state.bestCost) {
+            state.currentLine = 14; // best = min(...)
+            state.bestCost = g + other.gCost[neighbor];
+            state.meetForward = isForward ? current : neighbor;
+            state.meetBackward = isForward ? neighbor : current;
+        }
+
+        if (side.marks.closed(neighbor)) continue;
+
+        state.currentLine = 8; // if g < gCost[neighbor]
+        if (!side.marks.seen(neighbor) || g < side.gCost[neighbor]) {
+            state.currentLine = 9; // parent[neighbor] = current, gCost[neighbor] = g
+            side.marks.open(neighbor);
+            side.parent[neighbor] = current;
+            side.gCost[neighbor] = g;
+
+            state.currentLine = 10; // key = 2g + h(other end) - h(own end)
+            int key = 2 * g + heuristic(grid, neighbor, otherRoot, state.move) - heuristic(grid, neighbor, ownRoot, state.move);
+            side.openSet.push_back({neighbor, key});
+            std::push_heap(side.openSet.begin(), side.openSet.end(), std::greater<BidirectionalNode>());
+            state.currentLine = 11; // open.add(neighbor)
+            paint(grid, neighbor, isForward ? NodeType::Open : NodeType::OpenBack);
+        }
+    }
+}
+
+void startBidirectionalAStar(GridModel& grid, BidirectionalAStarState& state, bool isDiagonal, bool cutCorners) {
+    resetBidirectionalAStar(state);
+    state.move = moveCosts(isDiagonal, cutCorners);
+    // Each root is alone in its heap and is expanded before any stopping test can
+    // use its key, so the key itself does not matter.
+    prepareFrontier(state.forward, grid.size(), grid.startIndex, 0);
+    prepareFrontier(state.backward, grid.size(), grid.endIndex, 0);
+    state.isSearching = true;
+}
+
+void resetBidirectionalAStar(BidirectionalAStarState& state) {
+    state.isSearching = false;
+    state.isComplete = false;
+    state.noPathExists = false;
+    resetLivePath(state.livePath);
+    state.forward.openSet.clear();
+    state.forward.tip = -1;
+    state.forward.expanded = 0;
+    state.backward.openSet.clear();
+    state.backward.tip = -1;
+    state.backward.expanded = 0;
+    state.bestCost = INT_MAX;
+    state.meetForward = -1;
+    state.meetBackward = -1;
+    state.currentLine = 0;
+    state.nodesVisited = 0;
+    state.pathCost = 0;
+}
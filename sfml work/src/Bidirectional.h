@@ -0,0 +1,173 @@
+// ===================================================================================
+// == FILE: src/Bidirectional.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Header file for the bidirectional searches: Bidirectional BFS and
+// Bidirectional A*. Each runs one frontier forward from the start and one backward
+// from the end, and stops once no connection through the unexplored cells can beat
+// the best meeting found so far. The two frontiers are painted in different colours.
+//
+// ===================================================================================
+#ifndef BIDIRECTIONAL_H
+#define BIDIRECTIONAL_H
+
+#include "GridModel.h"
+#include "Heuristics.h"
+#include "LivePath.h"
+#include "SearchMarks.h"
+#include <climits>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief One half of a bidirectional BFS: a FIFO queue grown from one end.
+ */
+struct BFSFrontier {
+    std::vector<int> queue;     // Read from 'head', so its memory is reused between runs.
+    std::size_t head = 0;
+    SearchMarks marks;          // Cells this half has reached.
+    std::vector<int> parent;    // parent[i]: the neighbour of i one move closer to this half's root.
+    std::vector<int> dist;      // dist[i]: moves from this half's root to i (valid for seen cells).
+    int tip = -1;               // The cell this half expanded last (for the live path).
+    int expanded = 0;           // Cells this half has taken off its queue.
+};
+
+/**
+ * @brief Holds all state information for a Bidirectional BFS in progress.
+ */
+struct BidirectionalBFSState {
+    BFSFrontier forward;  // Grows from the start.
+    BFSFrontier backward; // Grows from the end.
+
+    // The shortest start-to-end connection found so far, in moves, and the two cells
+    // on either side of the move where it crosses from one half to the other.
+    int bestMoves = INT_MAX;
+    int meetForward = -1;
+    int meetBackward = -1;
+
+    // --- State Flags ---
+    bool isSearching = false;  // True while the algorithm is actively running.
+    bool isComplete = false;   // True when the algorithm has finished (found a path or not).
+    bool noPathExists = false; // True if a frontier runs out before the halves meet.
+
+    // --- Visualization & Stats ---
+    int currentLine = 0;      // The current line of pseudocode to highlight.
+    int nodesVisited = 0;     // Cells expanded by both halves together.
+    int pathCost = 0;         // The total cost of the final path found.
+    bool drawLivePath = true; // Headless runs turn this off to skip the per-step path redraw.
+    LivePath livePath;        // The yellow path painted by the previous step.
+    std::vector<int> chain;   // Scratch buffer for the cells of the live path.
+};
+
+/**
+ * @brief A node wrapper for the bidirectional A* priority queues.
+ *
+ * 'key' is twice the node's priority (see BidirectionalAStarState), so it stays an
+ * integer. The overloaded '>' operator turns std::greater into a min-heap.
+ */
+struct BidirectionalNode {
+    int node;
+    int key;
+
+    bool operator>(const BidirectionalNode& other) const {
+        return key > other.key;
+    }
+};
+
+/**
+ * @brief One half of a bidirectional A*: an open set grown from one end.
+ */
+struct AStarFrontier {
+    std::vector<BidirectionalNode> openSet; // Binary min-heap on 'key'.
+    SearchMarks marks;                      // Open/closed markers for this half.
+    std::vector<int> parent;                // parent[i]: the neighbour of i one move closer to this half's root.
+    std::vector<int> gCost;                 // gCost[i]: best known cost between this half's root and i.
+    int tip = -1;                           // The cell this half expanded last (for the live path).
+    int expanded = 0;                       // Cells this half has closed.
+};
+
+/**
+ * @brief Holds all state information for a Bidirectional A* search in progress.
+ *
+ * Both halves use the "average" potential p(v) = (h(v, end) - h(v, start)) / 2
+ * (forward) and its negation (backward). Those keep every reduced move cost
+ * non-negative in both directions, which makes the classic bidirectional Dijkstra
+ * stopping rule exact: the search can stop once the two smallest keys add up to at
+ * least twice the best connection found (keys are stored doubled).
+ */
+struct BidirectionalAStarState {
+    AStarFrontier forward;  // Grows from the start, moving into cells.
+    AStarFrontier backward; // Grows from the end, moving out of cells.
+
+    // The cheapest start-to-end connection found so far, and the cells on either
+    // side of the move where it crosses from one half to the other.
+    int bestCost = INT_MAX;
+    int meetForward = -1;
+    int meetBackward = -1;
+    MoveCosts move = moveCosts(false); // Step costs, the same as A*'s (set by startBidirectionalAStar).
+
+    // --- State Flags ---
+    bool isSearching = false;  // True while the algorithm is actively running.
+    bool isComplete = false;   // True when the algorithm has finished (found a path or not).
+    bool noPathExists = false; // True if an open set runs out before the halves meet.
+
+    // --- Visualization & Stats ---
+    int currentLine = 0;      // The current line of pseudocode to highlight.
+    int nodesVisited = 0;     // Cells expanded by both halves together.
+    int pathCost = 0;         // The total cost of the final path found, in move.straight units per step.
+    bool drawLivePath = true; // Headless runs turn this off to skip the per-step path redraw.
+    LivePath livePath;        // The yellow path painted by the previous step.
+    std::vector<int> chain;   // Scratch buffer for the cells of the live path.
+};
+
+/**
+ * @brief Performs a single step of Bidirectional BFS: expands one cell from the
+ * half with the smaller queue.
+ * @param grid The pathfinding grid model (passed by reference).
+ * @param state The current state of the search (passed by reference).
+ * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
+ */
+void bidirectionalBFSStep(GridModel& grid, BidirectionalBFSState& state, bool isDiagonal);
+
+/**
+ * @brief Resets the Bidirectional BFS state and seeds the halves with the start and end.
+ * @param grid The pathfinding grid model; its startIndex and endIndex must be set.
+ * @param state The state object to initialize (passed by reference).
+ */
+void startBidirectionalBFS(GridModel& grid, BidirectionalBFSState& state);
+
+/**
+ * @brief Resets the Bidirectional BFS state to its default values for a new search.
+ * @param state The state object to reset (passed by reference).
+ */
+void resetBidirectionalBFS(BidirectionalBFSState& state);
+
+/**
+ * @brief Performs a single step of Bidirectional A*: expands one cell from the
+ * half with the smaller open set. Weighted cells are supported.
+ * @param grid The pathfinding grid model (passed by reference).
+ * @param state The current state of the search (passed by reference).
+ * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
+ */
+void bidirectionalAStarStep(GridModel& grid, BidirectionalAStarState& state, bool isDiagonal);
+
+/**
+ * @brief Resets the Bidirectional A* state and seeds the halves with the start and end.
+ * @param grid The pathfinding grid model; its startIndex and endIndex must be set.
+ * @param state The state object to initialize (passed by reference).
+ * @param isDiagonal Whether diagonal moves are allowed; it picks the step costs.
+ * @param cutCorners Whether a diagonal may pass a wall's corner (the Moving AI
+ * scenarios forbid it).
+ */
+void startBidirectionalAStar(GridModel& grid, BidirectionalAStarState& state, bool isDiagonal,
+                             bool cutCorners = true);
+
+/**
+ * @brief Resets the Bidirectional A* state to its default values for a new search.
+ * @param state The state object to reset (passed by reference).
+ */
+void resetBidirectionalAStar(BidirectionalAStarState& state);
+
+#endif // BIDIRECTIONAL_H
@@ -0,0 +1,306 @@
+// ===================================================================================
+// == FILE: src/BitBFS.cpp ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Implements the bitboard BFS: packing the grid, the scalar and AVX2
+// level expansion, and recovering the path from the level bit planes.
+//
+// ===================================================================================
+#include "BitBFS.h"
+#include <algorithm>
+
+// GCC and Clang can compile an AVX2 function into an otherwise generic build and
+// pick it at run time, so the executable still runs on CPUs without AVX2.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define BITBFS_AVX2 1
+#include <immintrin.h>
+#endif
+
+bool bitBFSHasAVX2() {
+#ifdef BITBFS_AVX2
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+static inline int popCount(std::uint64_t bits) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(bits);
+#else
+    int count = 0;
+    for (; bits; bits &= bits - 1) count++;
+    return count;
+#endif
+}
+
+static inline int lowestBit(std::uint64_t bits) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(bits);
+#else
+    int bit = 0;
+    while (!(bits & 1)) {
+        bits >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+// The offset of word w of row r in the padded layout.
+static inline int wordAt(const BitBFSState& state, int r, int w) {
+    return (r + 1) * state.stride + w + 1;
+}
+
+static inline bool testBit(const std::vector<std::uint64_t>& bits, const BitBFSState& state, int r, int c) {
+    return (bits[wordAt(state, r, c / 64)] >> (c % 64)) & 1;
+}
+
+static inline bool reached(const BitBFSState& state, int r, int c) {
+    return testBit(state.open, state, r, c) && !testBit(state.unreached, state, r, c);
+}
+
+// A row's cells plus their left and right neighbours.
+static inline std::uint64_t spread(const std::uint64_t* row, int w) {
+    return row[w] | (row[w] << 1) | (row[w - 1] >> 63) | (row[w] >> 1) | (row[w + 1] << 63);
+}
+
+/**
+ * @brief Computes next = grow(frontier) & unreached for words [w, hi] of a row.
+ * 'base' is the offset of the row's word 0; the rows above and below are one stride away.
+ */
+static void expandScalar(BitBFSState& state, int base, int w, int hi, bool isDiagonal) {
+    const std::uint64_t* up = &state.frontier[base - state.stride];
+    const std::uint64_t* mid = &state.frontier[base];
+    const std::uint64_t* down = &state.frontier[base + state.stride];
+    for (; w <= hi; ++w) {
+        std::uint64_t reach = isDiagonal ? spread(up, w) | spread(mid, w) | spread(down, w)
+                                         : spread(mid, w) | up[w] | down[w];
+        state.next[base + w] = reach & state.unreached[base + w];
+    }
+}
+
+#ifdef BITBFS_AVX2
+__attribute__((target("avx2"))) static inline __m256i spread4(const std::uint64_t* row, int w) {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + w));
+    __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + w - 1));
+    __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + w + 1));
+    __m256i grown = _mm256_or_si256(_mm256_slli_epi64(x, 1), _mm256_srli_epi64(x, 1));
+    grown = _mm256_or_si256(grown, _mm256_or_si256(_mm256_srli_epi64(left, 63), _mm256_slli_epi64(right, 63)));
+    return _mm256_or_si256(x, grown);
+}
+
+/**
+ * @brief The AVX2 version of expandScalar(), four words at a time. Returns the first
+ * word it did not do (fewer than four words remain), for the scalar loop to finish.
+ */
+__attribute__((target("avx2"))) static int expandAVX2(BitBFSState& state, int base, int w, int hi, bool isDiagonal) {
+    const std::uint64_t* up = &state.frontier[base - state.stride];
+    const std::uint64_t* mid = &state.frontier[base];
+    const std::uint64_t* down = &state.frontier[base + state.stride];
+    for (; w + 3 <= hi; w += 4) {
+        __m256i reach;
+        if (isDiagonal) {
+            reach = _mm256_or_si256(_mm256_or_si256(spread4(up, w), spread4(mid, w)), spread4(down, w));
+        } else {
+            __m256i vertical = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(up + w)),
+                                               _mm256_loadu_si256(reinterpret_cast<const __m256i*>(down + w)));
+            reach = _mm256_or_si256(spread4(mid, w), vertical);
+        }
+        __m256i unreached = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&state.unreached[base + w]));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&state.next[base + w]), _mm256_and_si256(reach, unreached));
+    }
+    return w;
+}
+#endif
+
+// Packs the cells BFS may enter, unless the walls and weights are unchanged.
+static void packOpenCells(const GridModel& grid, BitBFSState& state) {
+    if (state.packedEdits == grid.editCount() && state.packedCells == grid.size()) return;
+    state.words = (grid.cols + 63) / 64;
+    state.stride = state.words + 2;
+    std::size_t total = static_cast<std::size_t>(grid.rows + 2) * state.stride;
+    state.open.assign(total, 0);
+    for (int i = 0; i < grid.size(); ++i) {
+        NodeType type = grid.types[i];
+        if (type == NodeType::Wall || grid.costs[i] != 1) continue;
+        int c = grid.colOf(i);
+        state.open[wordAt(state, grid.rowOf(i), c / 64)] |= std::uint64_t(1) << (c % 64);
+    }
+    for (std::vector<std::uint64_t>* bits : {&state.unreached, &state.frontier, &state.next, &state.levelLow, &state.levelHigh}) {
+        bits->assign(total, 0);
+    }
+    state.frontierRows.clear();
+    state.packedEdits = grid.editCount();
+    state.packedCells = grid.size();
+}
+
+/**
+ * @brief Adds words [lo, hi] of a row to an ascending row list. Rows arrive in
+ * ascending order except for the one or two just below the last, which are widened.
+ */
+static void addSpan(std::vector<BitRowSpan>& rows, int row, int lo, int hi) {
+    for (std::size_t i = rows.size(); i > 0 && rows[i - 1].row >= row; --i) {
+        if (rows[i - 1].row == row) {
+            rows[i - 1].lo = std::min(rows[i - 1].lo, lo);
+            rows[i - 1].hi = std::max(rows[i - 1].hi, hi);
+            return;
+        }
+    }
+    rows.push_back({row, lo, hi});
+}
+
+// Zeroes the frontier words of the listed rows.
+static void clearRows(std::vector<std::uint64_t>& bits, const BitBFSState& state, const std::vector<BitRowSpan>& rows) {
+    for (const BitRowSpan& span : rows) {
+        int base = wordAt(state, span.row, 0);
+        std::fill(bits.begin() + base + span.lo, bits.begin() + base + span.hi + 1, 0);
+    }
+}
+
+// Walks back from the goal through cells one level lower each time.
+static void tracePath(const GridModel& grid, BitBFSState& state, bool isDiagonal) {
+    static const int DR[] = {-1, 1, 0, 0, -1, -1, 1, 1};
+    static const int DC[] = {0, 0, -1, 1, -1, 1, -1, 1};
+    int numDirections = isDiagonal ? 8 : 4;
+
+    state.path.clear();
+    int cell = grid.endIndex;
+    state.path.push_back(cell);
+    for (int level = state.level; level > 0; --level) {
+        int wanted = (level - 1) % 3;
+        int r = grid.rowOf(cell);
+        int c = grid.colOf(cell);
+        for (int i = 0; i < numDirections; ++i) {
+            int nr = r + DR[i];
+            int nc = c + DC[i];
+            if (!grid.isValid(nr, nc) || !reached(state, nr, nc)) continue;
+            int mod3 = testBit(state.levelLow, state, nr, nc) ? 1 : testBit(state.levelHigh, state, nr, nc) ? 2 : 0;
+            if (mod3 == wanted) {
+                cell = grid.index(nr, nc);
+                break;
+            }
+        }
+        state.path.push_back(cell);
+    }
+    std::reverse(state.path.begin(), state.path.end());
+}
+
+void bitBFSStep(GridModel& grid, BitBFSState& state, bool isDiagonal) {
+    if (!state.isSearching || state.isComplete) return;
+
+    state.currentLine = 4; // while frontier is not empty
+    if (state.frontierRows.empty()) {
+        state.noPathExists = true;
+        state.isSearching = false;
+        state.isComplete = true;
+        state.currentLine = 13;
+        return;
+    }
+
+    // 1. Every word next to a frontier word may gain cells: the frontier's own rows and
+    //    the rows above and below. A span only widens into the word beside it when a
+    //    frontier cell sits on that edge and its move crosses into the next word.
+    state.currentLine = 5; // next = grow(frontier) & open & ~visited
+    state.sweepRows.clear();
+    for (const BitRowSpan& span : state.frontierRows) {
+        int base = wordAt(state, span.row, 0);
+        int lo = span.lo - (state.frontier[base + span.lo] & 1 ? 1 : 0);
+        int hi = span.hi + (state.frontier[base + span.hi] >> 63 ? 1 : 0);
+        lo = std::max(lo, 0);
+        hi = std::min(hi, state.words - 1);
+        for (int r = std::max(span.row - 1, 0); r <= std::min(span.row + 1, grid.rows - 1); ++r) {
+            addSpan(state.sweepRows, r, lo, hi);
+        }
+    }
+
+    // 2. Expand row by row. A row's new cells can be marked reached straight away:
+    //    the other rows only read their own unreached words.
+    state.level++;
+    std::vector<std::uint64_t>* plane = state.level % 3 == 1 ? &state.levelLow
+                                      : state.level % 3 == 2 ? &state.levelHigh : nullptr;
+    bool simd = state.usedSIMD;
+    state.nextRows.clear();
+    for (const BitRowSpan& span : state.sweepRows) {
+        int base = wordAt(state, span.row, 0);
+        int w = span.lo;
+#ifdef BITBFS_AVX2
+        if (simd) w = expandAVX2(state, base, w, span.hi, isDiagonal);
+#endif
+        expandScalar(state, base, w, span.hi, isDiagonal);
+        state.wordsSwept += span.hi - span.lo + 1;
+
+        state.currentLine = 6; // visited |= next
+        int first = -1, last = -1;
+        for (w = span.lo; w <= span.hi; ++w) {
+            std::uint64_t bits = state.next[base + w];
+            if (!bits) continue;
+            if (first < 0) first = w;
+            last = w;
+            state.unreached[base + w] &= ~bits;
+            if (plane) (*plane)[base + w] |= bits;
+            state.nodesVisited += popCount(bits);
+            if (!state.paintCells) continue;
+            for (; bits; bits &= bits - 1) {
+                int cell = grid.index(span.row, 64 * w + lowestBit(bits));
+                if (cell != grid.endIndex) grid.setType(cell, NodeType::Visited);
+            }
+        }
+        if (first >= 0) state.nextRows.push_back({span.row, first, last});
+    }
+
+    // 3. The old frontier is cleared word by word, and the new level takes its place.
+    //    Every other word of 'next' is zero, so it stays clean for the next level.
+    state.currentLine = 7; // frontier = next
+    clearRows(state.frontier, state, state.frontierRows);
+    state.frontier.swap(state.next);
+    state.frontierRows.swap(state.nextRows);
+
+    state.currentLine = 8; // if goal in frontier
+    if (reached(state, grid.rowOf(grid.endIndex), grid.colOf(grid.endIndex))) {
+        state.currentLine = 9; // path = walk back one level at a time
+        tracePath(grid, state, isDiagonal);
+        for (int cell : state.path) state.pathCost += grid.costs[cell];
+        if (state.paintCells) setLivePath(grid, state.livePath, state.path);
+        state.isComplete = true;
+        state.isSearching = false;
+        state.currentLine = 10; // return PathFound
+    }
+}
+
+void startBitBFS(GridModel& grid, BitBFSState& state) {
+    resetBitBFS(state);
+    packOpenCells(grid, state);
+    // Every open cell starts unreached; the last run's level planes and frontier are cleared.
+    state.unreached = state.open;
+    std::fill(state.levelLow.begin(), state.levelLow.end(), 0);
+    std::fill(state.levelHigh.begin(), state.levelHigh.end(), 0);
+    clearRows(state.frontier, state, state.frontierRows);
+    state.frontierRows.clear();
+    state.usedSIMD = state.allowSIMD && bitBFSHasAVX2();
+
+    int r = grid.rowOf(grid.startIndex);
+    int c = grid.colOf(grid.startIndex);
+    std::uint64_t bit = std::uint64_t(1) << (c % 64);
+    state.unreached[wordAt(state, r, c / 64)] &= ~bit;
+    state.frontier[wordAt(state, r, c / 64)] |= bit;
+    state.frontierRows.push_back({r, c / 64, c / 64});
+    state.nodesVisited = 1;
+    state.isSearching = true;
+}
+
+void resetBitBFS(BitBFSState& state) {
+    state.isSearching = false;
+    state.isComplete = false;
+    state.noPathExists = false;
+    resetLivePath(state.livePath);
+    state.currentLine = 0;
+    state.level = 0;
+    state.nodesVisited = 0;
+    state.pathCost = 0;
+    state.wordsSwept = 0;
+    state.path.clear();
+}
@@ -0,0 +1,112 @@
+// ===================================================================================
+// == FILE: src/BitBFS.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Header file for the bit-parallel (bitboard) Breadth-First Search.
+// On an unweighted grid one BFS level is just the frontier grown by one cell in
+// every direction, masked by the open cells and minus the cells already reached.
+// With the grid packed 64 cells to a word, that is a handful of shifts, ANDs and
+// ORs per word, so each step of this search expands a whole level at once. The
+// word loop uses AVX2 (four words at a time) when the CPU has it.
+//
+// ===================================================================================
+#ifndef BITBFS_H
+#define BITBFS_H
+
+#include "GridModel.h"
+#include "LivePath.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Words lo ... hi (inclusive) of one row of a bitmap.
+ */
+struct BitRowSpan {
+    int row;
+    int lo;
+    int hi;
+};
+
+/**
+ * @brief Holds all state information for a bitboard BFS in progress.
+ *
+ * Every bitmap uses the same padded layout: row r, word w lives at
+ * (r + 1) * stride + w + 1, and bit b of that word is column 64 * w + b. A zero
+ * word on both sides of each row and a zero row above and below the grid let the
+ * shifts read their neighbours without bounds checks.
+ */
+struct BitBFSState {
+    // --- Packed Grid ---
+    int words = 0;                        // 64-cell words per row.
+    int stride = 0;                       // Words per padded row.
+    std::vector<std::uint64_t> open;      // Cells BFS may enter: not walls, and (as in bfsStep) not weights.
+    std::uint64_t packedEdits = UINT64_MAX; // The grid's editCount() when 'open' was packed.
+    int packedCells = 0;
+
+    // --- Search Bitmaps ---
+    std::vector<std::uint64_t> unreached; // Open cells not reached yet ('open' minus the visited cells).
+    std::vector<std::uint64_t> frontier;  // The cells of the current level.
+    std::vector<std::uint64_t> next;      // The level being built.
+
+    // Each reached cell's level mod 3, as two bit planes (level 1: low, level 2: high).
+    // Adjacent reached cells are at most one level apart, so walking back from the
+    // goal, the neighbour whose level is one lower mod 3 is the one a level closer to
+    // the start. This recovers the path without a parent array.
+    std::vector<std::uint64_t> levelLow;
+    std::vector<std::uint64_t> levelHigh;
+
+    // The rows holding frontier bits, in ascending order, with the word span each one
+    // occupies, so a level only sweeps the words next to its frontier.
+    std::vector<BitRowSpan> frontierRows, nextRows, sweepRows;
+
+    // --- State Flags ---
+    bool isSearching = false;
+    bool isComplete = false;
+    bool noPathExists = false;
+
+    // --- Visualization & Stats ---
+    bool allowSIMD = true;     // Cleared to time the scalar word loop.
+    bool usedSIMD = false;     // True if this run swept with AVX2.
+    bool paintCells = true;    // Headless runs turn this off to skip painting each level.
+    int currentLine = 0;
+    int level = 0;             // The level of the frontier (the start is level 0).
+    int nodesVisited = 0;      // Cells reached.
+    int pathCost = 0;
+    long long wordsSwept = 0;  // Words the expansion computed, over the whole run.
+    std::vector<int> path;     // The path found, start first.
+    LivePath livePath;         // The yellow path painted once the goal is reached.
+};
+
+/**
+ * @brief Expands the next BFS level in one go.
+ * @param grid The pathfinding grid model (passed by reference).
+ * @param state The current state of the search (passed by reference).
+ * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
+ */
+void bitBFSStep(GridModel& grid, BitBFSState& state, bool isDiagonal);
+
+/**
+ * @brief Resets the state, packs the grid if it changed and seeds the start cell.
+ *
+ * Packing reads every cell, but only happens when the grid's walls or weights
+ * have been edited since the last run; each run clears its bitmaps, which is also
+ * O(cells / 64).
+ * @param grid The pathfinding grid model; its startIndex and endIndex must be set.
+ * @param state The state object to initialize (passed by reference).
+ */
+void startBitBFS(GridModel& grid, BitBFSState& state);
+
+/**
+ * @brief Resets the state to its default values for a new search.
+ * @param state The state object to reset (passed by reference).
+ */
+void resetBitBFS(BitBFSState& state);
+
+/**
+ * @brief True if the build has the AVX2 word loop and the CPU supports it.
+ */
+bool bitBFSHasAVX2();
+
+#endif // BITBFS_H
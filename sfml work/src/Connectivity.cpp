@@ -0,0 +1,256 @@
+// ===================================================================================
+// == FILE: src/Connectivity.cpp ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Implements the region index: the full labelling, the union-find
+// merges for erased walls and the split search for new ones.
+//
+// ===================================================================================
+#include "Connectivity.h"
+#include <utility>
+
+static const int DR[] = {-1, 1, 0, 0, -1, -1, 1, 1};
+static const int DC[] = {0, 0, -1, 1, -1, 1, -1, 1};
+
+// The eight cells around a cell in circular order (N, NE, E, SE, S, SW, W, NW), so
+// that consecutive entries always share a side.
+static const int RING_R[] = {-1, -1, 0, 1, 1, 1, 0, -1};
+static const int RING_C[] = {0, 1, 1, 1, 0, -1, -1, -1};
+
+static int findRegion(ConnectivityIndex& index, int id) {
+    while (index.parent[id] != id) {
+        index.parent[id] = index.parent[index.parent[id]]; // Path halving.
+        id = index.parent[id];
+    }
+    return id;
+}
+
+static int newRegion(ConnectivityIndex& index) {
+    int id = static_cast<int>(index.parent.size());
+    index.parent.push_back(id);
+    index.rank.push_back(0);
+    index.regions++;
+    return id;
+}
+
+static int uniteRegions(ConnectivityIndex& index, int a, int b) {
+    a = findRegion(index, a);
+    b = findRegion(index, b);
+    if (a == b) return a;
+    if (index.rank[a] < index.rank[b]) std::swap(a, b);
+    index.parent[b] = a;
+    if (index.rank[a] == index.rank[b]) index.rank[a]++;
+    index.regions--;
+    return a;
+}
+
+static bool isOpen(const GridModel& grid, const ConnectivityIndex& index, int r, int c) {
+    return grid.isValid(r, c) && !index.blocked[grid.index(r, c)];
+}
+
+// Labels every region from scratch with a flood fill.
+static void rebuild(const GridModel& grid, ConnectivityIndex& index, bool isDiagonal) {
+    int cells = grid.size();
+    int numDirections = isDiagonal ? 8 : 4;
+    index.label.assign(cells, -1);
+    index.blocked.resize(cells);
+    for (int i = 0; i < cells; ++i) index.blocked[i] = grid.types[i] == NodeType::Wall;
+    index.parent.clear();
+    index.rank.clear();
+    index.regions = 0;
+
+    std::vector<int> stack;
+    for (int seed = 0; seed < cells; ++seed) {
+        if (index.blocked[seed] || index.label[seed] >= 0) continue;
+        int id = newRegion(index);
+        index.label[seed] = id;
+        stack.assign(1, seed);
+        while (!stack.empty()) {
+            int current = stack.back();
+            stack.pop_back();
+            int r = grid.rowOf(current);
+            int c = grid.colOf(current);
+            for (int i = 0; i < numDirections; ++i) {
+                if (!isOpen(grid, index, r + DR[i], c + DC[i])) continue;
+                int neighbor = grid.index(r + DR[i], c + DC[i]);
+                if (index.label[neighbor] >= 0) continue;
+                index.label[neighbor] = id;
+                stack.push_back(neighbor);
+            }
+        }
+    }
+
+    index.seenStamp.assign(cells, 0);
+    index.seenBy.assign(cells, -1);
+    index.stamp = 0;
+    index.builtCells = cells;
+    index.builtDiagonal = isDiagonal;
+    index.fullBuilds++;
+}
+
+// An erased wall joins the regions of all its open neighbours.
+static void openCell(const GridModel& grid, ConnectivityIndex& index, int cell, bool isDiagonal) {
+    index.blocked[cell] = 0;
+    int r = grid.rowOf(cell);
+    int c = grid.colOf(cell);
+    int id = -1;
+    for (int i = 0; i < (isDiagonal ? 8 : 4); ++i) {
+        if (!isOpen(grid, index, r + DR[i], c + DC[i])) continue;
+        int neighborId = index.label[grid.index(r + DR[i], c + DC[i])];
+        id = id < 0 ? findRegion(index, neighborId) : uniteRegions(index, id, neighborId);
+    }
+    index.label[cell] = id >= 0 ? id : newRegion(index);
+}
+
+/**
+ * @brief Finds the pieces a region fell into after a wall cut it.
+ *
+ * One search grows from each seed, taking turns one cell at a time. Two searches
+ * that meet are in the same piece and continue as one; a search that runs out of
+ * cells has found a whole piece, which gets a new region id. When a single search
+ * is left, the cells it has not reached keep the old id, so the largest piece is
+ * never walked in full.
+ */
+static void splitRegion(const GridModel& grid, ConnectivityIndex& index, const std::vector<int>& seeds, bool isDiagonal) {
+    struct Piece {
+        std::vector<int> cells;   // Every cell found so far.
+        std::vector<int> pending; // Found but not yet expanded.
+        int mergedInto;           // Itself while the search is its own.
+        bool finished = false;
+    };
+    if (++index.stamp == 0) {
+        index.seenStamp.assign(index.seenStamp.size(), 0);
+        index.stamp = 1;
+    }
+    index.splitSearches++;
+
+    int count = static_cast<int>(seeds.size());
+    std::vector<Piece> pieces(count);
+    for (int p = 0; p < count; ++p) {
+        pieces[p].cells.assign(1, seeds[p]);
+        pieces[p].pending.assign(1, seeds[p]);
+        pieces[p].mergedInto = p;
+        index.seenStamp[seeds[p]] = index.stamp;
+        index.seenBy[seeds[p]] = p;
+    }
+    auto owner = [&](int p) {
+        while (pieces[p].mergedInto != p) p = pieces[p].mergedInto;
+        return p;
+    };
+
+    int live = count;
+    int numDirections = isDiagonal ? 8 : 4;
+    while (live > 1) {
+        for (int p = 0; p < count && live > 1; ++p) {
+            Piece& piece = pieces[p];
+            if (piece.mergedInto != p || piece.finished) continue;
+            if (piece.pending.empty()) {
+                int id = newRegion(index);
+                for (int cell : piece.cells) index.label[cell] = id;
+                piece.finished = true;
+                index.splits++;
+                live--;
+                continue;
+            }
+            int current = piece.pending.back();
+            piece.pending.pop_back();
+            index.cellsSearched++;
+            int r = grid.rowOf(current);
+            int c = grid.colOf(current);
+            for (int i = 0; i < numDirections; ++i) {
+                if (!isOpen(grid, index, r + DR[i], c + DC[i])) continue;
+                int neighbor = grid.index(r + DR[i], c + DC[i]);
+                if (index.seenStamp[neighbor] != index.stamp) {
+                    index.seenStamp[neighbor] = index.stamp;
+                    index.seenBy[neighbor] = p;
+                    piece.cells.push_back(neighbor);
+                    piece.pending.push_back(neighbor);
+                    continue;
+                }
+                int other = owner(index.seenBy[neighbor]);
+                if (other == p) continue;
+                Piece& met = pieces[other];
+                piece.cells.insert(piece.cells.end(), met.cells.begin(), met.cells.end());
+                piece.pending.insert(piece.pending.end(), met.pending.begin(), met.pending.end());
+                met.cells.clear();
+                met.pending.clear();
+                met.mergedInto = p;
+                live--;
+            }
+        }
+    }
+}
+
+// A new wall may cut its region in two. Neighbours that are joined through the
+// ring of cells around the wall are certainly still connected, so the split search
+// only starts from one neighbour of each group the ring leaves apart.
+static void closeCell(const GridModel& grid, ConnectivityIndex& index, int cell, bool isDiagonal) {
+    index.blocked[cell] = 1;
+    index.label[cell] = -1;
+    int r = grid.rowOf(cell);
+    int c = grid.colOf(cell);
+
+    bool open[8];
+    int group[8];
+    for (int k = 0; k < 8; ++k) {
+        open[k] = isOpen(grid, index, r + RING_R[k], c + RING_C[k]);
+        group[k] = k;
+    }
+    for (int a = 0; a < 8; ++a) {
+        for (int b = a + 1; b < 8; ++b) {
+            int dr = RING_R[a] - RING_R[b];
+            int dc = RING_C[a] - RING_C[b];
+            bool touching = dr >= -1 && dr <= 1 && dc >= -1 && dc <= 1 && (isDiagonal || dr == 0 || dc == 0);
+            if (!open[a] || !open[b] || !touching) continue;
+            int ga = group[a];
+            int gb = group[b];
+            for (int k = 0; k < 8; ++k) {
+                if (group[k] == gb) group[k] = ga;
+            }
+        }
+    }
+
+    // Diagonal ring cells are neighbours only with 8-directional movement.
+    std::vector<int> seeds;
+    bool seeded[8] = {};
+    for (int k = 0; k < 8; ++k) {
+        bool isNeighbor = isDiagonal || k % 2 == 0;
+        if (!open[k] || !isNeighbor || seeded[group[k]]) continue;
+        seeded[group[k]] = true;
+        seeds.push_back(grid.index(r + RING_R[k], c + RING_C[k]));
+    }
+    if (seeds.empty()) {
+        index.regions--; // The cell was a region on its own.
+    } else if (seeds.size() > 1) {
+        splitRegion(grid, index, seeds, isDiagonal);
+    }
+}
+
+void syncConnectivity(const GridModel& grid, ConnectivityIndex& index, bool isDiagonal) {
+    bool full = index.builtCells != grid.size() || index.builtDiagonal != isDiagonal ||
+                index.editsApplied < grid.editsBase;
+    if (!full) {
+        for (std::size_t i = index.editsApplied - grid.editsBase; i < grid.edits.size(); ++i) {
+            int cell = grid.edits[i];
+            bool isWall = grid.types[cell] == NodeType::Wall;
+            if (isWall == static_cast<bool>(index.blocked[cell])) continue; // A weight edit, or undone since.
+            if (isWall) {
+                closeCell(grid, index, cell, isDiagonal);
+            } else {
+                openCell(grid, index, cell, isDiagonal);
+            }
+        }
+        // Every split and isolated cell takes a new id; relabel once they pile up.
+        full = index.parent.size() > 2 * static_cast<std::size_t>(grid.size()) + 64;
+    }
+    if (full) rebuild(grid, index, isDiagonal);
+    index.editsApplied = grid.editCount();
+}
+
+bool cellsConnected(const GridModel& grid, ConnectivityIndex& index, int a, int b, bool isDiagonal) {
+    syncConnectivity(grid, index, isDiagonal);
+    if (a < 0 || b < 0 || index.blocked[a] || index.blocked[b]) return false;
+    return findRegion(index, index.label[a]) == findRegion(index, index.label[b]);
+}
@@ -0,0 +1,76 @@
+// ===================================================================================
+// == FILE: src/Connectivity.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Defines ConnectivityIndex, which knows which region of open cells
+// every cell belongs to, so a start and end in different regions can be rejected
+// before any search floods the start's whole region to find that out.
+//
+// Each open cell carries a region id, and a union-find over the ids merges regions
+// when a wall is erased between them. Union-find cannot split, so when a new wall
+// might cut a region in two, the pieces are found by searching outwards from its
+// neighbours at the same pace and stopping as soon as only one piece is left
+// unexplored: only the smaller pieces are visited, and they are given fresh ids.
+//
+// ===================================================================================
+#ifndef CONNECTIVITY_H
+#define CONNECTIVITY_H
+
+#include "GridModel.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The region index of a grid, kept up to date from its edit journal.
+ *
+ * Weights count as open cells: a weighted search may cross them, so two cells in
+ * different regions are unreachable for every search.
+ */
+struct ConnectivityIndex {
+    std::vector<int> label;          // The region id of each open cell, -1 for walls.
+    std::vector<int> parent;         // Union-find over region ids.
+    std::vector<std::uint8_t> rank;
+    std::vector<std::uint8_t> blocked; // The wall layout the labels describe.
+    int regions = 0;                   // Regions of open cells.
+
+    std::uint64_t editsApplied = 0; // How far the grid's edit journal has been replayed.
+    int builtCells = -1;            // Grid size the index was built for (-1 = never built).
+    bool builtDiagonal = false;     // Connectivity the index was built for.
+
+    // Scratch for the split search, reused between walls.
+    std::vector<std::uint32_t> seenStamp;
+    std::vector<int> seenBy;
+    std::uint32_t stamp = 0;
+
+    // --- Stats ---
+    int fullBuilds = 0;
+    int splitSearches = 0;          // Walls whose neighbours were not joined around them.
+    int splits = 0;                 // Regions cut off by a wall.
+    long long cellsSearched = 0;    // Cells the split searches visited.
+};
+
+/**
+ * @brief Brings the index up to date with the grid.
+ *
+ * Replays the walls added or removed since the last call; rebuilds everything if
+ * the grid was resized, the connectivity changed or the journal dropped edits.
+ * @param grid The pathfinding grid model.
+ * @param index The index to update (passed by reference).
+ * @param isDiagonal Whether cells touching at a corner are connected.
+ */
+void syncConnectivity(const GridModel& grid, ConnectivityIndex& index, bool isDiagonal);
+
+/**
+ * @brief True if both cells are open and in the same region. Costs two finds on
+ * an index that is already up to date.
+ * @param grid The pathfinding grid model.
+ * @param index The index (updated first if the grid changed).
+ * @param a The first cell.
+ * @param b The second cell.
+ * @param isDiagonal Whether cells touching at a corner are connected.
+ */
+bool cellsConnected(const GridModel& grid, ConnectivityIndex& index, int a, int b, bool isDiagonal);
+
+#endif // CONNECTIVITY_H
@@ -11,40 +11,7 @@
 // ===================================================================================
 #include "DFS.h"
 
-/**
- * @brief A helper function to visualize the current path being explored by DFS.
- *
- * This function is responsible for the "live path" effect. It clears the previous
- * yellow path and then traces backwards from the current node to draw the new path.
- *
- * @param grid The main pathfinding grid.
- * @param currentNode The node the algorithm is currently processing.
- * @param parentMap The map used to trace the path backwards.
- */
-void drawCurrentDFSPath(Grid& grid, Node* currentNode, std::map<Node*, Node*>& parentMap) {
-    // 1. Clear any old path nodes back to 'visited' color.
-    for (int i = 0; i < grid.rows; ++i) {
-        for (int j = 0; j < grid.cols; ++j) {
-            if (grid.nodes[i][j].type == NodeType::Path) {
-                grid.nodes[i][j].type = NodeType::Visited;
-                grid.nodes[i][j].shape.setFillColor(sf::Color(173, 216, 230)); // Visited color
-            }
-        }
-    }
-
-    // 2. Draw the new path from the start to the current node in yellow.
-    Node* tracer = currentNode;
-    while (tracer != grid.startNode && tracer != nullptr) {
-        if (tracer != grid.endNode) {
-            tracer->type = NodeType::Path;
-            tracer->shape.setFillColor(sf::Color::Yellow);
-        }
-        tracer = parentMap[tracer];
-    }
-}
-
-
-void dfsStep(Grid& grid, DFSState& state, bool isDiagonal) {
+void dfsStep(GridModel& grid, DFSState& state, bool isDiagonal) {
     if (!state.isSearching || state.isComplete) {
         return;
     }
@@ -59,25 +26,28 @@ void dfsStep(Grid& grid, DFSState& state, bool isDiagonal) {
         return;
     }
 
-    // 1. Get the next node to process from the top of the stack.
-    Node* current = state.stack.top();
-    state.stack.pop();
-    state.nodesVisited++; // Increment the statistics counter.
+    // 1. Get the next cell to process from the top of the stack.
+    int current = state.stack.back();
+    state.stack.pop_back();
     state.currentLine = 4; // current = S.pop()
 
-    // Mark as visited if it's not already. This prevents getting stuck in cycles.
-    if (current->type == NodeType::Empty) {
-        state.currentLine = 6; // mark current as visited
-        current->type = NodeType::Visited;
-        current->shape.setFillColor(sf::Color(173, 216, 230));
+    // A cell can sit on the stack more than once; only its first pop explores it.
+    // This prevents getting stuck in cycles.
+    if (state.marks.closed(current)) return;
+    state.nodesVisited++; // Increment the statistics counter.
+
+    state.currentLine = 6; // mark current as visited
+    state.marks.close(current);
+    if (grid.types[current] != NodeType::Start) {
+        grid.setType(current, NodeType::Visited);
     }
     
     // 2. Visualize the current exploration path.
-    drawCurrentDFSPath(grid, current, state.parentMap);
+    if (state.drawLivePath) updateLivePath(grid, state.livePath, current, state.parent);
 
     // 3. Find and process all valid neighbors.
-    int r = current->row;
-    int c = current->col;
+    int r = grid.rowOf(current);
+    int c = grid.colOf(current);
     int dr[] = {-1, 1, 0, 0, -1, -1, 1, 1};
     int dc[] = {0, 0, -1, 1, -1, 1, -1, 1}; 
 
@@ -88,20 +58,18 @@ void dfsStep(Grid& grid, DFSState& state, bool isDiagonal) {
         int new_c = c + dc[i];
 
         // Ensure the neighbor is within the grid boundaries.
-        if (new_r >= 0 && new_r < grid.rows && new_c >= 0 && new_c < grid.cols) {
-            Node& neighbor = grid.nodes[new_r][new_c];
+        if (grid.isValid(new_r, new_c)) {
+            int neighbor = grid.index(new_r, new_c);
 
             // If we found the end node, the search is complete.
             state.currentLine = 7; // if current is endNode then
-            if (&neighbor == grid.endNode) {
-                state.parentMap[&neighbor] = current;
-                drawCurrentDFSPath(grid, &neighbor, state.parentMap);
+            if (neighbor == grid.endIndex) {
+                state.parent[neighbor] = current;
+                if (state.drawLivePath) updateLivePath(grid, state.livePath, neighbor, state.parent);
                 
                 // Calculate the final path cost by tracing backwards.
-                Node* tracer = &neighbor;
-                while(tracer != nullptr) {
-                    state.pathCost += tracer->cost;
-                    tracer = state.parentMap[tracer];
+                for (int tracer = neighbor; tracer != -1; tracer = state.parent[tracer]) {
+                    state.pathCost += grid.costs[tracer];
                 }
 
                 state.isComplete = true;
@@ -110,10 +78,12 @@ void dfsStep(Grid& grid, DFSState& state, bool isDiagonal) {
                 return;
             }
 
-            // If the neighbor is an unvisited empty square, push it to the stack to explore next.
-            if (neighbor.type == NodeType::Empty) {
-                state.parentMap[&neighbor] = current;
-                state.stack.push(&neighbor);
+            // If the neighbor is an unvisited open square, push it to the stack to explore next.
+            NodeType neighborType = grid.types[neighbor];
+            if (!state.marks.closed(neighbor) && neighborType != NodeType::Wall && neighborType != NodeType::Weight) {
+                state.marks.open(neighbor);
+                state.parent[neighbor] = current;
+                state.stack.push_back(neighbor);
                 state.currentLine = 11; // S.push(neighbor)
             }
         }
@@ -121,16 +91,25 @@ void dfsStep(Grid& grid, DFSState& state, bool isDiagonal) {
 }
 
 
+void startDFS(GridModel& grid, DFSState& state) {
+    resetDFS(state);
+    state.marks.begin(grid.size());
+    if (static_cast<int>(state.parent.size()) != grid.size()) state.parent.resize(grid.size());
+    state.marks.open(grid.startIndex);
+    state.parent[grid.startIndex] = -1;
+    state.stack.push_back(grid.startIndex);
+    state.isSearching = true;
+}
+
 void resetDFS(DFSState& state) {
     state.isSearching = false;
     state.isComplete = false;
     state.noPathExists = false;
-    state.parentMap.clear();
+    resetLivePath(state.livePath);
     state.currentLine = 0;
     state.nodesVisited = 0;
     state.pathCost = 0;
     
-    // Efficiently clear the stack.
-    std::stack<Node*> empty;
-    state.stack.swap(empty);
-}
\ No newline at end of file
+    // Clear the stack but keep its capacity for the next run.
+    state.stack.clear();
+}
@@ -12,24 +12,28 @@
 #ifndef DFS_H
 #define DFS_H
 
-#include "Grid.h"
-#include <stack>
+#include "GridModel.h"
+#include "LivePath.h"
+#include "SearchMarks.h"
 #include <vector>
-#include <map>
 
 /**
  * @brief Holds all state information for a Depth-First Search in progress.
  *
  * This struct contains the stack for managing nodes to visit (LIFO - Last-In, First-Out),
- * a map to reconstruct the path, and various flags and counters for controlling
+ * generation-stamped visited markers, a parent array to reconstruct the path, and various flags and counters for controlling
  * the visualization and tracking statistics.
  */
 struct DFSState {
     // The core data structure for DFS, ensuring a depth-first exploration.
-    std::stack<Node*> stack;
+    // A vector used as a stack keeps its memory from run to run.
+    std::vector<int> stack;
 
-    // Maps a node to the node from which it was reached. Used to reconstruct the path.
-    std::map<Node*, Node*> parentMap;
+    // Which cells this run has visited. Starting a run is O(1).
+    SearchMarks marks;
+
+    // parent[i] is the cell from which cell i was reached (valid for cells marked seen).
+    std::vector<int> parent;
 
     // --- State Flags ---
     bool isSearching = false;  // True while the algorithm is actively running.
@@ -40,15 +44,24 @@ struct DFSState {
     int currentLine = 0;   // The current line of pseudocode to highlight.
     int nodesVisited = 0;  // A counter for the total number of nodes processed.
     int pathCost = 0;      // The total cost of the final path found.
+    bool drawLivePath = true; // Headless runs turn this off to skip the per-step path redraw.
+    LivePath livePath;        // The yellow path painted by the previous step.
 };
 
 /**
  * @brief Performs a single step of the DFS algorithm.
- * @param grid The main pathfinding grid (passed by reference).
+ * @param grid The pathfinding grid model (passed by reference).
  * @param state The current state of the DFS search (passed by reference).
  * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
  */
-void dfsStep(Grid& grid, DFSState& state, bool isDiagonal);
+void dfsStep(GridModel& grid, DFSState& state, bool isDiagonal);
+
+/**
+ * @brief Resets the DFS state and seeds it with the grid's start cell.
+ * @param grid The pathfinding grid model; its startIndex must be set.
+ * @param state The DFS state object to initialize (passed by reference).
+ */
+void startDFS(GridModel& grid, DFSState& state);
 
 /**
  * @brief Resets the DFS state to its default values for a new search.
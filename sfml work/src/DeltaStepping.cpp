@@ -0,0 +1,240 @@
+// ===================================================================================
+// == FILE: src/DeltaStepping.cpp ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Implements delta-stepping: the parallel light and heavy
+// relaxations, the bucket ring and the path read back from the settled costs.
+//
+// ===================================================================================
+#include "DeltaStepping.h"
+#include <algorithm>
+#include <limits>
+
+static const int DR[] = {-1, 1, 0, 0, -1, -1, 1, 1};
+static const int DC[] = {0, 0, -1, 1, -1, 1, -1, 1};
+static const int UNREACHED = std::numeric_limits<int>::max();
+
+// The slice [first, last) of 'count' items that a worker handles.
+static void sliceFor(int worker, int workers, std::size_t count, std::size_t& first, std::size_t& last) {
+    first = count * worker / workers;
+    last = count * (worker + 1) / workers;
+}
+
+// Relaxes the light (cost <= delta) or the heavy moves out of a worker's slice of
+// 'from', recording every cell whose cost it lowered.
+static void relaxMoves(const GridModel& grid, DeltaSteppingState& state, const std::vector<int>& from,
+                       bool light, int worker, int workers, bool isDiagonal) {
+    std::vector<int>& out = state.localRequests[worker];
+    std::size_t first, last;
+    sliceFor(worker, workers, from.size(), first, last);
+    int numDirections = isDiagonal ? 8 : 4;
+    long long lowered = 0;
+    for (std::size_t k = first; k < last; ++k) {
+        int current = from[k];
+        int currentCost = state.dist[current].load(std::memory_order_relaxed);
+        int r = grid.rowOf(current);
+        int c = grid.colOf(current);
+        for (int i = 0; i < numDirections; ++i) {
+            int nr = r + DR[i];
+            int nc = c + DC[i];
+            if (!grid.isValid(nr, nc)) continue;
+            int neighbor = grid.index(nr, nc);
+            if (grid.types[neighbor] == NodeType::Wall) continue;
+            if (i >= 4 && !state.move.cutCorners && grid.cutsCorner(r, c, DR[i], DC[i])) continue;
+            int move = grid.costs[neighbor] * (i < 4 ? state.move.straight : state.move.diagonal);
+            if ((move <= state.activeDelta) != light) continue;
+
+            int newCost = currentCost + move;
+            int known = state.dist[neighbor].load(std::memory_order_relaxed);
+            while (newCost < known) {
+                if (state.dist[neighbor].compare_exchange_weak(known, newCost, std::memory_order_relaxed)) {
+                    out.push_back(neighbor);
+                    lowered++;
+                    break;
+                }
+            }
+        }
+    }
+    state.localRelaxations[worker] += lowered;
+}
+
+// Runs one relaxation pass over 'from' (on the pool if it is big enough) and files
+// the lowered cells into the buckets their new costs fall in.
+static void relaxAndFile(GridModel& grid, DeltaSteppingState& state, const std::vector<int>& from,
+                         bool light, bool isDiagonal) {
+    bool inParallel = from.size() >= static_cast<std::size_t>(state.minParallelWork);
+    int workers = inParallel ? state.pool->size() : 1;
+    auto job = [&](int worker) { relaxMoves(grid, state, from, light, worker, workers, isDiagonal); };
+    if (inParallel) state.pool->run(job); else job(0);
+
+    int ring = static_cast<int>(state.buckets.size());
+    for (std::vector<int>& requests : state.localRequests) {
+        for (int cell : requests) {
+            int target = state.dist[cell].load(std::memory_order_relaxed) / state.activeDelta;
+            state.buckets[target % ring].push_back(cell);
+            state.queued++;
+            if (state.paintCells && grid.types[cell] != NodeType::Start && grid.types[cell] != NodeType::End) {
+                grid.setType(cell, NodeType::Open);
+            }
+        }
+        requests.clear();
+    }
+}
+
+// Walks back from the end through neighbours whose cost plus the move equals the
+// cell's own cost. Such a neighbour's cost is already final, because it is lower
+// than the end's and every bucket below the end's is settled.
+static void tracePath(const GridModel& grid, DeltaSteppingState& state, bool isDiagonal) {
+    int numDirections = isDiagonal ? 8 : 4;
+    state.path.clear();
+    int cell = grid.endIndex;
+    state.path.push_back(cell);
+    while (cell != grid.startIndex) {
+        int r = grid.rowOf(cell);
+        int c = grid.colOf(cell);
+        int cellCost = state.dist[cell].load();
+        for (int i = 0; i < numDirections; ++i) {
+            int nr = r + DR[i];
+            int nc = c + DC[i];
+            if (!grid.isValid(nr, nc)) continue;
+            if (i >= 4 && !state.move.cutCorners && grid.cutsCorner(r, c, DR[i], DC[i])) continue;
+            int neighbor = grid.index(nr, nc);
+            int neighborCost = state.dist[neighbor].load();
+            int move = grid.costs[cell] * (i < 4 ? state.move.straight : state.move.diagonal);
+            if (neighborCost != UNREACHED && grid.types[neighbor] != NodeType::Wall && neighborCost + move == cellCost) {
+                cell = neighbor;
+                break;
+            }
+        }
+        state.path.push_back(cell);
+    }
+    std::reverse(state.path.begin(), state.path.end());
+}
+
+void deltaSteppingStep(GridModel& grid, DeltaSteppingState& state, bool isDiagonal) {
+    if (!state.isSearching || state.isComplete) return;
+
+    state.currentLine = 3; // while any bucket is not empty
+    if (state.queued == 0) {
+        state.noPathExists = true;
+        state.isSearching = false;
+        state.isComplete = true;
+        state.currentLine = 16; // return PathNotFound
+        return;
+    }
+
+    // 1. Move on to the lowest bucket that holds anything.
+    state.currentLine = 4; // i = lowest non-empty bucket
+    int ring = static_cast<int>(state.buckets.size());
+    while (state.buckets[state.bucket % ring].empty()) state.bucket++;
+    std::vector<int>& current = state.buckets[state.bucket % ring];
+
+    // 2. Relax light moves in rounds until no cost drops into this bucket any more.
+    state.settled.clear();
+    while (!current.empty()) {
+        state.currentLine = 6; // R = cells taken out of B[i], S += R
+        state.rounds++;
+        state.round.clear();
+        for (int cell : current) {
+            if (state.dist[cell].load(std::memory_order_relaxed) / state.activeDelta != state.bucket) continue;
+            if (state.roundStamp[cell] == state.rounds) continue;
+            state.roundStamp[cell] = state.rounds;
+            state.round.push_back(cell);
+            if (state.bucketStamp[cell] != state.bucket) {
+                state.bucketStamp[cell] = state.bucket;
+                state.settled.push_back(cell);
+            }
+        }
+        state.queued -= static_cast<long long>(current.size());
+        current.clear();
+
+        state.currentLine = 7; // relax light moves out of R in parallel
+        relaxAndFile(grid, state, state.round, true, isDiagonal);
+    }
+
+    // 3. The bucket is final; its heavy moves all land in later buckets.
+    state.currentLine = 9; // relax heavy moves out of S in parallel
+    relaxAndFile(grid, state, state.settled, false, isDiagonal);
+    state.relaxations = 0;
+    for (long long lowered : state.localRelaxations) state.relaxations += lowered;
+
+    state.nodesVisited += static_cast<int>(state.settled.size());
+    state.bucketsSettled++;
+    if (state.paintCells) {
+        for (int cell : state.settled) {
+            if (grid.types[cell] != NodeType::Start && grid.types[cell] != NodeType::End) {
+                grid.setType(cell, NodeType::Visited);
+            }
+        }
+    }
+
+    // 4. Stop once the end's cost is final.
+    if (grid.endIndex >= 0 && state.bucketStamp[grid.endIndex] == state.bucket) {
+        state.currentLine = 11; // if end is in S then
+        tracePath(grid, state, isDiagonal);
+        state.pathCost = state.dist[grid.endIndex].load();
+        if (state.paintCells) setLivePath(grid, state.livePath, state.path);
+        state.isSearching = false;
+        state.isComplete = true;
+        state.currentLine = 13; // return PathFound
+        return;
+    }
+    state.bucket++;
+}
+
+void startDeltaStepping(GridModel& grid, DeltaSteppingState& state, bool isDiagonal, bool cutCorners) {
+    resetDeltaStepping(state);
+    state.move = moveCosts(isDiagonal, cutCorners);
+    int longestMove = WEIGHT_COST * (isDiagonal ? state.move.diagonal : state.move.straight);
+    // On these maps the widest bucket was fastest: narrower ones give each round too
+    // few cells to share out, and only save relaxations while the moves are light.
+    state.activeDelta = state.delta > 0 ? state.delta : longestMove;
+    state.buckets.resize(longestMove / state.activeDelta + 2);
+    for (std::vector<int>& bucket : state.buckets) bucket.clear();
+
+    int workers = state.threads > 0 ? state.threads : WorkerPool::hardwareWorkers();
+    if (!state.pool || state.pool->size() != workers) {
+        state.pool.reset();
+        state.pool.reset(new WorkerPool(workers));
+        state.localRequests.assign(workers, std::vector<int>());
+    }
+    state.localRelaxations.assign(workers, 0);
+
+    if (static_cast<int>(state.dist.size()) != grid.size()) {
+        state.dist = std::vector<std::atomic<int>>(grid.size());
+        state.roundStamp.resize(grid.size());
+        state.bucketStamp.resize(grid.size());
+    }
+    state.pool->run([&](int worker) {
+        std::size_t first, last;
+        sliceFor(worker, workers, grid.size(), first, last);
+        for (std::size_t i = first; i < last; ++i) {
+            state.dist[i].store(UNREACHED, std::memory_order_relaxed);
+            state.roundStamp[i] = -1;
+            state.bucketStamp[i] = -1;
+        }
+    });
+
+    state.dist[grid.startIndex].store(0);
+    state.buckets[0].push_back(grid.startIndex);
+    state.queued = 1;
+    state.isSearching = true;
+}
+
+void resetDeltaStepping(DeltaSteppingState& state) {
+    state.isSearching = false;
+    state.isComplete = false;
+    state.noPathExists = false;
+    resetLivePath(state.livePath);
+    state.bucket = 0;
+    state.queued = 0;
+    state.currentLine = 0;
+    state.nodesVisited = 0;
+    state.pathCost = 0;
+    state.bucketsSettled = 0;
+    state.rounds = 0;
+    state.relaxations = 0;
+    state.path.clear();
+}
@@ -0,0 +1,108 @@
+// ===================================================================================
+// == FILE: src/DeltaStepping.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Header file for delta-stepping, a parallel form of Dijkstra's
+// algorithm. Instead of settling one cell at a time, it sorts tentative costs into
+// buckets delta wide and settles a whole bucket per step. Within a bucket the
+// "light" moves (cost <= delta), which may land in the same bucket, are relaxed
+// in rounds until the bucket stops changing; the "heavy" moves, which always land
+// in a later bucket, are relaxed once at the end. Every round is split across a
+// pool of worker threads. Moves cost the same as in dijkstraStep, so both find
+// the same cost to every cell they settle.
+//
+// ===================================================================================
+#ifndef DELTASTEPPING_H
+#define DELTASTEPPING_H
+
+#include "GridModel.h"
+#include "Heuristics.h"
+#include "LivePath.h"
+#include "WorkerPool.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Holds all state information for a delta-stepping search in progress.
+ */
+struct DeltaSteppingState {
+    // --- Tuning ---
+    int threads = 0;            // Workers for the next run (0 = one per core).
+    int delta = 0;              // Bucket width for the next run (0 = the longest move, so every move is light).
+    int minParallelWork = 1024; // Rounds with fewer cells than this run on the calling thread alone.
+
+    std::unique_ptr<WorkerPool> pool; // Rebuilt only when the worker count changes.
+
+    MoveCosts move = moveCosts(false); // Step costs of the current run, the same as Dijkstra's.
+    int activeDelta = 1;               // The bucket width of the current run.
+
+    // dist[i] is the best known cost from the start to cell i. Workers lower it with
+    // an atomic compare-and-swap; each round's writes are published to the next one
+    // by the pool's hand-off.
+    std::vector<std::atomic<int>> dist;
+
+    // A ring of buckets: bucket b lives in slot b % buckets.size(). A move never
+    // reaches more than (longest move / delta) + 1 buckets ahead, so the ring is just
+    // long enough for that. A cell may sit in several buckets at once; the copies
+    // whose cost has since dropped out of the bucket are skipped.
+    std::vector<std::vector<int>> buckets;
+    int bucket = 0;                  // The bucket being settled.
+    long long queued = 0;            // Entries in all buckets.
+
+    std::vector<int> round;          // The cells relaxed in the current light round.
+    std::vector<int> settled;        // Every cell settled in the current bucket.
+    std::vector<int> roundStamp;     // roundStamp[i] == rounds if cell i is already in 'round'.
+    std::vector<int> bucketStamp;    // bucketStamp[i] == bucket if cell i is already in 'settled'.
+    std::vector<std::vector<int>> localRequests; // Per worker: cells whose cost it lowered.
+    std::vector<long long> localRelaxations;     // Per worker: successful relaxations.
+
+    // --- State Flags ---
+    bool isSearching = false;
+    bool isComplete = false;
+    bool noPathExists = false;
+
+    // --- Visualization & Stats ---
+    bool paintCells = true;      // Headless runs turn this off to skip painting each bucket.
+    int currentLine = 0;
+    int nodesVisited = 0;        // Cells settled.
+    int pathCost = 0;
+    int bucketsSettled = 0;
+    int rounds = 0;              // Light rounds over all buckets.
+    long long relaxations = 0;   // Costs lowered, over the whole run.
+    std::vector<int> path;       // Start to end, if the end was reached.
+    LivePath livePath;           // The yellow path painted once the end is settled.
+};
+
+/**
+ * @brief Settles the next non-empty bucket on all workers.
+ *
+ * The search stops once the bucket holding the end cell is settled, and then
+ * walks back from the end through neighbours whose cost plus the move equals
+ * the cell's own cost.
+ * @param grid The pathfinding grid model (passed by reference).
+ * @param state The current state of the search (passed by reference).
+ * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
+ */
+void deltaSteppingStep(GridModel& grid, DeltaSteppingState& state, bool isDiagonal);
+
+/**
+ * @brief Resets the state, (re)starts the worker pool if the thread count changed
+ * and seeds the start cell. Clearing the cost array is split across the workers.
+ * @param grid The pathfinding grid model; its startIndex must be set.
+ * @param state The state object to initialize (passed by reference).
+ * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
+ * @param cutCorners Whether a diagonal may pass a wall's corner (the Moving AI
+ * scenarios forbid it).
+ */
+void startDeltaStepping(GridModel& grid, DeltaSteppingState& state, bool isDiagonal, bool cutCorners = true);
+
+/**
+ * @brief Resets the state to its default values for a new search.
+ * @param state The state object to reset (passed by reference).
+ */
+void resetDeltaStepping(DeltaSteppingState& state);
+
+#endif // DELTASTEPPING_H
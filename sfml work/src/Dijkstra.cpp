@@ -11,14 +11,10 @@
 #include "Dijkstra.h"
 #include <limits>
 
-// Define specific colors for visualizing visited nodes, distinguishing between normal and weighted ("mud") nodes.
-const sf::Color VISITED_COLOR = sf::Color(173, 216, 230);
-const sf::Color VISITED_WEIGHT_COLOR = sf::Color(135, 168, 182); // A "muddy blue"
+// Visited weighted ("mud") cells are drawn in a darker blue by the grid view,
+// which reads the cell's cost alongside its Visited type.
 
-void drawCurrentDijkstraPath(Grid& grid, Node* currentNode, std::map<Node*, Node*>& parentMap);
-
-
-void dijkstraStep(Grid& grid, DijkstraState& state, bool isDiagonal) {
+void dijkstraStep(GridModel& grid, DijkstraState& state, bool isDiagonal) {
     if (!state.isSearching || state.isComplete) return;
 
     state.currentLine = 3; // while Q is not empty
@@ -30,47 +26,42 @@ void dijkstraStep(Grid& grid, DijkstraState& state, bool isDiagonal) {
         return;
     }
 
-    // 1. Get the node with the lowest cost from the priority queue.
+    // 1. Get the cell with the lowest cost from the priority queue.
     state.currentLine = 4; // u = vertex in Q with min distance
-    Node* current = state.openSet.top().node;
-    state.openSet.pop();
+    int current = state.openSet.pop().node;
     state.nodesVisited++;
     state.currentLine = 5; // remove u from Q
 
     // 2. Immediately check if we've reached the end.
     // This is done first to prevent the end node's color from ever changing.
-    if (current == grid.endNode) {
-        drawCurrentDijkstraPath(grid, current, state.parentMap);
-        // The final path cost is simply the cost recorded in our map for the end node.
+    if (current == grid.endIndex) {
+        if (state.drawLivePath) updateLivePath(grid, state.livePath, current, state.parent);
+        // The final path cost is simply the cost recorded for the end node.
         state.pathCost = state.costMap[current];
         state.isComplete = true;
         state.isSearching = false;
         return;
     }
 
-    // Optimization: If we've already processed this node, skip it.
-    // This can happen if a node is added to the queue multiple times with different costs.
-    if (current->type == NodeType::Visited) {
+    // Optimization: If we've already processed this cell, skip it.
+    // Only the plain binary heap queues a cell more than once; the other open sets
+    // lower the key of the entry that is already there.
+    if (state.marks.closed(current)) {
         return;
     }
 
-    // 3. Mark the current node as visited.
-    // We use a special color if the visited node is a high-cost "mud" node.
-    if (current->type != NodeType::Start) {
-        current->type = NodeType::Visited;
-        if (current->cost > 1) {
-            current->shape.setFillColor(VISITED_WEIGHT_COLOR);
-        } else {
-            current->shape.setFillColor(VISITED_COLOR);
-        }
+    // 3. Mark the current cell as visited.
+    state.marks.close(current);
+    if (grid.types[current] != NodeType::Start) {
+        grid.setType(current, NodeType::Visited);
     }
 
     // Update the live path visualization.
-    drawCurrentDijkstraPath(grid, current, state.parentMap);
+    if (state.drawLivePath) updateLivePath(grid, state.livePath, current, state.parent);
 
     // 4. Explore all valid neighbors.
-    int r = current->row;
-    int c = current->col;
+    int r = grid.rowOf(current);
+    int c = grid.colOf(current);
     int dr[] = {-1, 1, 0, 0, -1, -1, 1, 1};
     int dc[] = {0, 0, -1, 1, -1, 1, -1, 1};
 
@@ -80,70 +71,68 @@ void dijkstraStep(Grid& grid, DijkstraState& state, bool isDiagonal) {
         int new_r = r + dr[i];
         int new_c = c + dc[i];
 
-        if (new_r >= 0 && new_r < grid.rows && new_c >= 0 && new_c < grid.cols) {
-            Node& neighbor = grid.nodes[new_r][new_c];
+        if (grid.isValid(new_r, new_c)) {
+            int neighbor = grid.index(new_r, new_c);
+            NodeType neighborType = grid.types[neighbor];
 
-            if (neighbor.type == NodeType::Wall) {
+            if (neighborType == NodeType::Wall) {
                 continue; // Skip walls.
             }
+            if (i >= 4 && !state.move.cutCorners && grid.cutsCorner(r, c, dr[i], dc[i])) continue;
 
-            // 5. Calculate the cost to reach this neighbor through the current node.
+            // 5. Calculate the cost to reach this neighbor through the current cell.
             state.currentLine = 7; // alt = dist[u] + length(u, v)
-            int newCost = state.costMap[current] + neighbor.cost;
+            int step = i < 4 ? state.move.straight : state.move.diagonal;
+            int newCost = state.costMap[current] + grid.costs[neighbor] * step;
 
             // 6. If this path is cheaper than any previously found path, record it.
             state.currentLine = 8; // if alt < dist[v]
-            if (newCost < state.costMap[&neighbor]) {
+            int neighborCost = state.marks.seen(neighbor) ? state.costMap[neighbor] : std::numeric_limits<int>::max();
+            if (newCost < neighborCost) {
+                state.marks.open(neighbor);
                 state.currentLine = 9; // dist[v] = alt
-                state.costMap[&neighbor] = newCost;
+                state.costMap[neighbor] = newCost;
                 state.currentLine = 10; // prev[v] = u
-                state.parentMap[&neighbor] = current;
-                state.openSet.push({&neighbor, newCost});
+                state.parent[neighbor] = current;
+                state.openSet.push(neighbor, newCost);
 
                 // Visually mark the neighbor as being in the "open set".
-                if (neighbor.type != NodeType::End && neighbor.type != NodeType::Start) {
-                    neighbor.shape.setFillColor(sf::Color(200, 255, 200));
+                if (neighborType != NodeType::End && neighborType != NodeType::Start) {
+                    grid.setType(neighbor, NodeType::Open);
                 }
             }
         }
     }
 }
 
+void startDijkstra(GridModel& grid, DijkstraState& state, bool isDiagonal, bool cutCorners) {
+    resetDijkstra(state);
+    state.move = moveCosts(isDiagonal, cutCorners);
+    // A move only adds the cost of the cell entered times its step cost, so queued
+    // keys are never further apart than that.
+    int longestStep = isDiagonal ? state.move.diagonal : state.move.straight;
+    state.openSet.reset(state.queueKind, WEIGHT_COST * longestStep, grid.size());
+    state.marks.begin(grid.size());
+    if (static_cast<int>(state.parent.size()) != grid.size()) {
+        state.parent.resize(grid.size());
+        state.costMap.resize(grid.size());
+    }
+    state.marks.open(grid.startIndex);
+    state.parent[grid.startIndex] = -1;
+    state.costMap[grid.startIndex] = 0;
+    state.openSet.push(grid.startIndex, 0);
+    state.isSearching = true;
+}
+
 void resetDijkstra(DijkstraState& state) {
     state.isSearching = false;
     state.isComplete = false;
     state.noPathExists = false;
-    state.parentMap.clear();
-    state.costMap.clear();
+    resetLivePath(state.livePath);
     state.currentLine = 0;
     state.nodesVisited = 0;
     state.pathCost = 0;
     
-    // Efficiently clear the priority queue.
-    std::priority_queue<DijkstraNode, std::vector<DijkstraNode>, std::greater<DijkstraNode>> empty;
-    state.openSet.swap(empty);
+    // Clear the open set but keep its capacity for the next run.
+    state.openSet.clear();
 }
-
-void drawCurrentDijkstraPath(Grid& grid, Node* currentNode, std::map<Node*, Node*>& parentMap) {
-    for (int i = 0; i < grid.rows; ++i) {
-        for (int j = 0; j < grid.cols; ++j) {
-            if (grid.nodes[i][j].type == NodeType::Path) {
-                grid.nodes[i][j].type = NodeType::Visited;
-                // When clearing the old path, revert to the correct "visited" color.
-                if(grid.nodes[i][j].cost > 1) {
-                    grid.nodes[i][j].shape.setFillColor(VISITED_WEIGHT_COLOR);
-                } else {
-                    grid.nodes[i][j].shape.setFillColor(VISITED_COLOR);
-                }
-            }
-        }
-    }
-    Node* tracer = currentNode;
-    while (tracer != grid.startNode && tracer != nullptr) {
-        if (tracer != grid.endNode) {
-            tracer->type = NodeType::Path;
-            tracer->shape.setFillColor(sf::Color::Yellow);
-        }
-        tracer = parentMap[tracer];
-    }
-}
\ No newline at end of file
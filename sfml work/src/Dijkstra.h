@@ -12,39 +12,32 @@
 #ifndef DIJKSTRA_H
 #define DIJKSTRA_H
 
-#include "Grid.h"
+#include "GridModel.h"
+#include "Heuristics.h"
+#include "LivePath.h"
+#include "MonotoneQueue.h"
+#include "SearchMarks.h"
 #include <vector>
-#include <map>
-#include <queue>
-
-/**
- * @brief A node wrapper for Dijkstra's priority queue.
- *
- * Contains a pointer to a grid node and its associated cost from the start.
- * The overloaded '>' operator allows the priority queue to function as a min-heap,
- * always providing the node with the lowest known cost.
- */
-struct DijkstraNode {
-    Node* node;
-    int cost;
-
-    bool operator>(const DijkstraNode& other) const {
-        return cost > other.cost;
-    }
-};
 
 /**
  * @brief Holds all state information for a Dijkstra's search in progress.
  */
 struct DijkstraState {
-    // The "open set" of nodes to be evaluated, prioritized by lowest cost from start.
-    std::priority_queue<DijkstraNode, std::vector<DijkstraNode>, std::greater<DijkstraNode>> openSet;
-    
-    // Maps a node to the node from which it was reached. Used to reconstruct the path.
-    std::map<Node*, Node*> parentMap;
+    // The "open set" of nodes to be evaluated, keyed on cost. Clearing it keeps its
+    // memory for the next run.
+    MonotoneQueue openSet;
+    QueueKind queueKind = QueueKind::Auto; // The structure the next run's open set uses.
+    MoveCosts move = moveCosts(false);     // Step costs of the current run, the same as A*'s.
+
+    // Open/closed markers for this run. A cell's parent and cost are only
+    // meaningful once it is seen, so nothing has to be reset between runs.
+    SearchMarks marks;
 
-    // Maps a node to its known cost from the start node.
-    std::map<Node*, int> costMap;
+    // parent[i] is the cell from which cell i was reached.
+    std::vector<int> parent;
+
+    // costMap[i] is the best known cost from the start to cell i (only valid for seen cells).
+    std::vector<int> costMap;
 
     // --- State Flags ---
     bool isSearching = false;
@@ -55,15 +48,32 @@ struct DijkstraState {
     int currentLine = 0;
     int nodesVisited = 0;
     int pathCost = 0;
+    bool drawLivePath = true; // Headless runs turn this off to skip the per-step path redraw.
+    LivePath livePath;        // The yellow path painted by the previous step.
 };
 
 /**
  * @brief Performs a single step of Dijkstra's algorithm.
- * @param grid The main pathfinding grid (passed by reference).
+ * @param grid The pathfinding grid model (passed by reference).
  * @param state The current state of the Dijkstra's search (passed by reference).
  * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
  */
-void dijkstraStep(Grid& grid, DijkstraState& state, bool isDiagonal);
+void dijkstraStep(GridModel& grid, DijkstraState& state, bool isDiagonal);
+
+/**
+ * @brief Resets the Dijkstra's state and seeds it with the grid's start cell.
+ *
+ * Only a new marker generation is started, so the cost does not depend on the
+ * grid size; the parent and cost arrays are sized once and reused by later runs.
+ * The connectivity picks the movement model, which matches A*'s so the two can
+ * be compared.
+ * @param grid The pathfinding grid model; its startIndex must be set.
+ * @param state The Dijkstra's state object to initialize (passed by reference).
+ * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
+ * @param cutCorners Whether a diagonal may pass a wall's corner (the Moving AI
+ * scenarios forbid it).
+ */
+void startDijkstra(GridModel& grid, DijkstraState& state, bool isDiagonal, bool cutCorners = true);
 
 /**
  * @brief Resets the Dijkstra's state to its default values for a new search.
@@ -0,0 +1,148 @@
+// ===================================================================================
+// == FILE: src/DistanceMatrix.cpp ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Implements the many-to-many distance matrix: one BFS or Dijkstra
+// per source, with the sources handed out to the workers one at a time.
+//
+// ===================================================================================
+#include "DistanceMatrix.h"
+#include <atomic>
+#include <chrono>
+
+static const int DR[] = {-1, 1, 0, 0, -1, -1, 1, 1};
+static const int DC[] = {0, 0, -1, 1, -1, 1, -1, 1};
+
+/**
+ * @brief Breadth-first search from 'source' until every target is reached. Each
+ * step costs 1, so a cell's cost is final the moment it is reached.
+ */
+static void fillByBFS(const GridModel& grid, const DistanceMatrixState& state, DistanceScratch& scratch, int source,
+                      int targetsLeft) {
+    scratch.fifo.clear();
+    scratch.fifo.push_back(source);
+    scratch.marks.open(source);
+    scratch.dist[source] = 0;
+    if (state.targetCount[source] > 0) targetsLeft--;
+
+    for (std::size_t head = 0; head < scratch.fifo.size() && targetsLeft > 0; ++head) {
+        int current = scratch.fifo[head];
+        scratch.cellsSettled++;
+        int r = grid.rowOf(current);
+        int c = grid.colOf(current);
+        for (int i = 0; i < 4; ++i) {
+            int nr = r + DR[i];
+            int nc = c + DC[i];
+            if (!grid.isValid(nr, nc)) continue;
+            int neighbor = grid.index(nr, nc);
+            if (grid.types[neighbor] == NodeType::Wall || scratch.marks.seen(neighbor)) continue;
+            scratch.marks.open(neighbor);
+            scratch.dist[neighbor] = scratch.dist[current] + 1;
+            scratch.fifo.push_back(neighbor);
+            if (state.targetCount[neighbor] > 0) targetsLeft--;
+        }
+    }
+}
+
+/**
+ * @brief Dijkstra from 'source' until every target is settled, with the same move
+ * costs as dijkstraStep.
+ */
+static void fillByDijkstra(const GridModel& grid, const DistanceMatrixState& state, DistanceScratch& scratch,
+                           int source, int targetsLeft, bool isDiagonal, MoveCosts move) {
+    int numDirections = isDiagonal ? 8 : 4;
+    scratch.queue.reset(QueueKind::Auto, WEIGHT_COST * (isDiagonal ? move.diagonal : move.straight), grid.size());
+    scratch.marks.open(source);
+    scratch.dist[source] = 0;
+    scratch.queue.push(source, 0);
+
+    while (!scratch.queue.empty() && targetsLeft > 0) {
+        int current = scratch.queue.pop().node;
+        if (scratch.marks.closed(current)) continue;  // A stale binary heap entry.
+        scratch.marks.close(current);
+        scratch.cellsSettled++;
+        if (state.targetCount[current] > 0) targetsLeft--;
+
+        int r = grid.rowOf(current);
+        int c = grid.colOf(current);
+        for (int i = 0; i < numDirections; ++i) {
+            int nr = r + DR[i];
+            int nc = c + DC[i];
+            if (!grid.isValid(nr, nc)) continue;
+            int neighbor = grid.index(nr, nc);
+            if (grid.types[neighbor] == NodeType::Wall || scratch.marks.closed(neighbor)) continue;
+            int cost = scratch.dist[current] + grid.costs[neighbor] * (i < 4 ? move.straight : move.diagonal);
+            if (!scratch.marks.seen(neighbor) || cost < scratch.dist[neighbor]) {
+                scratch.marks.open(neighbor);
+                scratch.dist[neighbor] = cost;
+                scratch.queue.push(neighbor, cost);
+            }
+        }
+    }
+}
+
+void computeDistanceMatrix(const GridModel& grid, const std::vector<int>& sources, const std::vector<int>& targets,
+                           bool isDiagonal, DistanceMatrixState& state, DistanceMatrix& matrix) {
+    auto began = std::chrono::steady_clock::now();
+    matrix.sources = static_cast<int>(sources.size());
+    matrix.targets = static_cast<int>(targets.size());
+    matrix.costs.assign(static_cast<std::size_t>(matrix.sources) * matrix.targets, DISTANCE_UNREACHABLE);
+    matrix.move = moveCosts(isDiagonal);
+    matrix.cellsSettled = 0;
+
+    // Every step costs the same on a 4-connected map without weights, so BFS finds
+    // the same costs as Dijkstra without a priority queue.
+    matrix.usedBFS = !isDiagonal;
+    for (int i = 0; matrix.usedBFS && i < grid.size(); ++i) {
+        if (grid.costs[i] != 1 && grid.types[i] != NodeType::Wall) matrix.usedBFS = false;
+    }
+
+    // Count each open target cell once, so a search knows when it has found them all.
+    state.targetCount.assign(grid.size(), 0);
+    int distinctTargets = 0;
+    for (int target : targets) {
+        if (grid.types[target] == NodeType::Wall) continue;
+        if (state.targetCount[target]++ == 0) distinctTargets++;
+    }
+
+    int workers = state.threads > 0 ? state.threads : WorkerPool::hardwareWorkers();
+    if (!state.pool || state.pool->size() != workers) {
+        state.pool.reset();
+        state.pool.reset(new WorkerPool(workers));
+    }
+    state.scratch.resize(workers);
+    for (DistanceScratch& scratch : state.scratch) {
+        scratch.dist.resize(grid.size());
+        scratch.cellsSettled = 0;
+    }
+
+    // Sources are taken one at a time, so a worker that drew a quick one (a source in
+    // a small region) just takes the next.
+    std::atomic<int> nextSource(0);
+    state.pool->run([&](int worker) {
+        DistanceScratch& scratch = state.scratch[worker];
+        for (int s = nextSource++; s < matrix.sources; s = nextSource++) {
+            int source = sources[s];
+            if (grid.types[source] == NodeType::Wall || distinctTargets == 0) continue;
+            scratch.marks.begin(grid.size());
+            if (matrix.usedBFS) {
+                fillByBFS(grid, state, scratch, source, distinctTargets);
+            } else {
+                fillByDijkstra(grid, state, scratch, source, distinctTargets, isDiagonal, matrix.move);
+            }
+            // Every reached target is final: BFS fixes a cost when it reaches a cell, and
+            // Dijkstra stops only once all targets are settled or nothing is left.
+            int* row = &matrix.costs[static_cast<std::size_t>(s) * matrix.targets];
+            for (int t = 0; t < matrix.targets; ++t) {
+                int target = targets[t];
+                if (grid.types[target] != NodeType::Wall && scratch.marks.seen(target)) row[t] = scratch.dist[target];
+            }
+        }
+    });
+
+    for (const DistanceScratch& scratch : state.scratch) matrix.cellsSettled += scratch.cellsSettled;
+    matrix.threads = workers;
+    matrix.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - began).count();
+}
@@ -0,0 +1,88 @@
+// ===================================================================================
+// == FILE: src/DistanceMatrix.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: A batch API for many-to-many path costs. Given a set of source cells
+// and a set of target cells, it runs one full search per source (BFS on unweighted
+// 4-connected maps, Dijkstra otherwise) and fills a dense sources x targets matrix.
+// The sources are shared out over a pool of worker threads; the map is only read,
+// and every worker keeps its own cost array, markers and queue between sources, so
+// a batch allocates nothing per search.
+//
+// ===================================================================================
+#ifndef DISTANCEMATRIX_H
+#define DISTANCEMATRIX_H
+
+#include "GridModel.h"
+#include "Heuristics.h"
+#include "MonotoneQueue.h"
+#include "SearchMarks.h"
+#include "WorkerPool.h"
+#include <memory>
+#include <vector>
+
+// The matrix entry for a target that cannot be reached from a source.
+const int DISTANCE_UNREACHABLE = -1;
+
+/**
+ * @brief The path costs from every source to every target.
+ *
+ * Costs are in the same units as Dijkstra's path cost: 'move.straight' per ordinary
+ * step (1, or 100 with diagonals, where a diagonal costs 141), times the cost of the
+ * cell entered. A source or target on a wall reaches nothing.
+ */
+struct DistanceMatrix {
+    int sources = 0, targets = 0;
+    std::vector<int> costs;            // Row-major: costs[s * targets + t].
+    MoveCosts move = moveCosts(false);
+    bool usedBFS = false;              // True if the map allowed plain BFS.
+
+    int cost(int source, int target) const { return costs[static_cast<std::size_t>(source) * targets + target]; }
+
+    // --- Stats ---
+    int threads = 0;                   // Workers the batch ran on.
+    double seconds = 0.0;
+    long long cellsSettled = 0;        // Over all sources.
+};
+
+/**
+ * @brief One worker's scratch space, kept between sources and batches.
+ */
+struct DistanceScratch {
+    SearchMarks marks;        // Which cells the current source has reached.
+    std::vector<int> dist;    // dist[i]: cost from the current source, valid if marks.seen(i).
+    std::vector<int> fifo;    // BFS queue.
+    MonotoneQueue queue;      // Dijkstra's open set.
+    long long cellsSettled = 0;
+};
+
+/**
+ * @brief The worker pool and per-worker scratch arrays of the batch API.
+ */
+struct DistanceMatrixState {
+    int threads = 0;                  // Workers for the next batch (0 = one per core).
+    std::unique_ptr<WorkerPool> pool; // Rebuilt only when the worker count changes.
+    std::vector<DistanceScratch> scratch;
+
+    // Shared, read-only during a batch: how many times each cell is a target.
+    std::vector<int> targetCount;
+};
+
+/**
+ * @brief Fills a matrix with the path costs from every source to every target.
+ *
+ * Each search stops as soon as every target has been settled, so a batch whose
+ * targets sit close to the sources does not flood the whole map.
+ * @param grid The map (only read; its start, end and search markers are ignored).
+ * @param sources The source cells (rows of the matrix).
+ * @param targets The target cells (columns of the matrix).
+ * @param isDiagonal Whether diagonal moves are allowed.
+ * @param state The pool and scratch space to run with.
+ * @param matrix Receives the costs and the batch's stats.
+ */
+void computeDistanceMatrix(const GridModel& grid, const std::vector<int>& sources, const std::vector<int>& targets,
+                           bool isDiagonal, DistanceMatrixState& state, DistanceMatrix& matrix);
+
+#endif // DISTANCEMATRIX_H
@@ -0,0 +1,224 @@
+// ===================================================================================
+// == FILE: src/FlowField.cpp ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Implements the flow field: the reverse Dijkstra that builds the
+// integration and direction fields, and their incremental update after edits.
+//
+// ===================================================================================
+#include "FlowField.h"
+#include <chrono>
+
+// OPPOSITE[i] is the move that undoes move i.
+static const int OPPOSITE[8] = {1, 0, 3, 2, 7, 6, 5, 4};
+
+// Updates replaying more edits than this share of the grid rebuild from scratch.
+static const int REBUILD_FRACTION = 8;
+
+/**
+ * @brief Relaxes the moves into a settled cell. Walking backwards from the goal,
+ * the move being priced is the one from the neighbour into 'current', which costs
+ * 'current's cost times the step.
+ */
+static void relaxInto(const GridModel& grid, FlowFieldState& state, int current, int numDirections) {
+    int r = grid.rowOf(current);
+    int c = grid.colOf(current);
+    for (int i = 0; i < numDirections; ++i) {
+        int nr = r + FLOW_DR[i];
+        int nc = c + FLOW_DC[i];
+        if (!grid.isValid(nr, nc)) continue;
+        int neighbor = grid.index(nr, nc);
+        if (grid.types[neighbor] == NodeType::Wall) continue;
+        int cost = state.cost[current] + grid.costs[current] * (i < 4 ? state.move.straight : state.move.diagonal);
+        if (cost < state.cost[neighbor]) {
+            if (state.cost[neighbor] == FLOW_UNREACHED) state.reachable++;
+            state.cost[neighbor] = cost;
+            state.direction[neighbor] = static_cast<std::int8_t>(OPPOSITE[i]);
+            state.queue.push(neighbor, cost);
+        }
+    }
+}
+
+// Pops the next cell whose entry is current, or returns -1 once the queue is empty.
+// Only the binary heap keeps stale entries (for cells whose cost dropped later).
+static int popCurrent(FlowFieldState& state) {
+    while (!state.queue.empty()) {
+        QueueEntry entry = state.queue.pop();
+        if (entry.key == state.cost[entry.node]) return entry.node;
+    }
+    return -1;
+}
+
+static void finish(const GridModel& grid, FlowFieldState& state) {
+    state.isSearching = false;
+    state.isComplete = true;
+    int start = grid.startIndex;
+    state.noPathExists = start < 0 || state.cost[start] == FLOW_UNREACHED;
+    state.pathCost = state.noPathExists ? 0 : state.cost[start];
+    state.currentLine = 11; // every agent at x moves to x + dir[x]
+}
+
+void startFlowField(const GridModel& grid, FlowFieldState& state, bool isDiagonal) {
+    resetFlowField(state);
+    if (grid.endIndex < 0) return;
+    state.goal = grid.endIndex;
+    state.builtCells = grid.size();
+    state.builtDiagonal = isDiagonal;
+    state.editsApplied = grid.editCount();
+    state.move = moveCosts(isDiagonal);
+
+    state.cost.assign(grid.size(), FLOW_UNREACHED);
+    state.direction.assign(grid.size(), -1);
+    int longestStep = isDiagonal ? state.move.diagonal : state.move.straight;
+    state.queue.reset(QueueKind::Auto, WEIGHT_COST * longestStep, grid.size());
+    state.cost[state.goal] = 0;
+    state.reachable = 1;
+    state.queue.push(state.goal, 0);
+    state.isSearching = true;
+    state.currentLine = 2; // Q = {goal}
+}
+
+void flowFieldStep(const GridModel& grid, FlowFieldState& state, bool isDiagonal) {
+    if (!state.isSearching || state.isComplete) return;
+    int batch = state.cellsPerStep > 0 ? state.cellsPerStep : grid.cols;
+    int numDirections = isDiagonal ? 8 : 4;
+    for (int settled = 0; settled < batch; ++settled) {
+        state.currentLine = 4; // u = cell in Q with min cost
+        int current = popCurrent(state);
+        if (current < 0) {
+            finish(grid, state);
+            return;
+        }
+        state.nodesVisited++;
+        state.currentLine = 8; // cost[v] = c, dir[v] = towards u
+        relaxInto(grid, state, current, numDirections);
+    }
+}
+
+void resetFlowField(FlowFieldState& state) {
+    state.goal = -1;
+    state.builtCells = 0;
+    state.cost.clear();
+    state.direction.clear();
+    state.queue.clear();
+    state.isSearching = false;
+    state.isComplete = false;
+    state.noPathExists = false;
+    state.currentLine = 0;
+    state.nodesVisited = 0;
+    state.pathCost = 0;
+    state.reachable = 0;
+    state.lastUpdateCells = 0;
+    state.lastUpdateIncremental = false;
+    state.lastUpdateSeconds = 0.0;
+}
+
+bool flowFieldStale(const GridModel& grid, const FlowFieldState& state, bool isDiagonal) {
+    return state.goal != grid.endIndex || state.builtCells != grid.size() || state.builtDiagonal != isDiagonal ||
+           state.editsApplied != grid.editCount();
+}
+
+void updateFlowField(const GridModel& grid, FlowFieldState& state, bool isDiagonal) {
+    auto began = std::chrono::steady_clock::now();
+    int numDirections = isDiagonal ? 8 : 4;
+    bool rebuild = !state.isComplete || state.goal != grid.endIndex || state.builtCells != grid.size() ||
+                   state.builtDiagonal != isDiagonal || state.editsApplied < grid.editsBase ||
+                   grid.editCount() - state.editsApplied > static_cast<std::uint64_t>(grid.size() / REBUILD_FRACTION);
+
+    if (rebuild) {
+        startFlowField(grid, state, isDiagonal);
+        while (state.isSearching) flowFieldStep(grid, state, isDiagonal);
+        state.lastUpdateCells = state.nodesVisited;
+        state.lastUpdateIncremental = false;
+        state.lastUpdateSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - began).count();
+        return;
+    }
+
+    std::size_t first = static_cast<std::size_t>(state.editsApplied - grid.editsBase);
+    auto forget = [&state](int cell) {
+        state.cost[cell] = FLOW_UNREACHED;
+        state.direction[cell] = -1;
+        state.reachable--;
+        state.invalid.push_back(cell);
+    };
+    // Forgets the cells whose direction leads into 'parent'.
+    auto forgetChildren = [&](int parent) {
+        int r = grid.rowOf(parent);
+        int c = grid.colOf(parent);
+        for (int i = 0; i < numDirections; ++i) {
+            int nr = r + FLOW_DR[i];
+            int nc = c + FLOW_DC[i];
+            if (!grid.isValid(nr, nc)) continue;
+            int child = grid.index(nr, nc);
+            if (state.cost[child] != FLOW_UNREACHED && state.direction[child] == OPPOSITE[i]) forget(child);
+        }
+    };
+    // Gives a forgotten (or newly opened) cell the best cost through a neighbour
+    // that still has one.
+    auto seedFromNeighbours = [&](int cell) {
+        int r = grid.rowOf(cell);
+        int c = grid.colOf(cell);
+        int best = FLOW_UNREACHED, bestMove = -1;
+        for (int i = 0; i < numDirections; ++i) {
+            int nr = r + FLOW_DR[i];
+            int nc = c + FLOW_DC[i];
+            if (!grid.isValid(nr, nc)) continue;
+            int neighbor = grid.index(nr, nc);
+            if (grid.types[neighbor] == NodeType::Wall || state.cost[neighbor] == FLOW_UNREACHED) continue;
+            int cost = state.cost[neighbor] + grid.costs[neighbor] * (i < 4 ? state.move.straight : state.move.diagonal);
+            if (cost < best) {
+                best = cost;
+                bestMove = i;
+            }
+        }
+        if (bestMove < 0) return;
+        if (state.cost[cell] == FLOW_UNREACHED) state.reachable++;
+        state.cost[cell] = best;
+        state.direction[cell] = static_cast<std::int8_t>(bestMove);
+        state.queue.push(cell, best);
+    };
+
+    // 1. Every cell whose route ran through an edited cell has a stale cost: the
+    //    edited cell's descendants in the tree the directions form, and the cell
+    //    itself if it is now a wall. Forgetting a cost also marks the cell as found,
+    //    so each one is collected once.
+    state.invalid.clear();
+    for (std::size_t k = first; k < grid.edits.size(); ++k) {
+        int edited = grid.edits[k];
+        if (grid.types[edited] == NodeType::Wall && state.cost[edited] != FLOW_UNREACHED) forget(edited);
+        std::size_t next = state.invalid.size();
+        forgetChildren(edited);
+        while (next < state.invalid.size()) forgetChildren(state.invalid[next++]);
+    }
+
+    // 2. Seed the forgotten cells from the neighbours that kept their cost, and queue
+    //    the open edited cells so the moves into them are priced with their new cost.
+    //    The seeds' keys are in no particular order, which only the binary heap allows.
+    state.queue.reset(QueueKind::BinaryHeap, 0, grid.size());
+    for (int cell : state.invalid) {
+        if (grid.types[cell] != NodeType::Wall) seedFromNeighbours(cell);
+    }
+    for (std::size_t k = first; k < grid.edits.size(); ++k) {
+        int edited = grid.edits[k];
+        if (grid.types[edited] == NodeType::Wall) continue;
+        if (state.cost[edited] == FLOW_UNREACHED) {
+            seedFromNeighbours(edited);
+        } else {
+            state.queue.push(edited, state.cost[edited]);
+        }
+    }
+
+    // 3. A reverse Dijkstra from the seeds settles every cell whose cost changed.
+    state.lastUpdateCells = 0;
+    for (int current = popCurrent(state); current >= 0; current = popCurrent(state)) {
+        state.lastUpdateCells++;
+        relaxInto(grid, state, current, numDirections);
+    }
+
+    state.editsApplied = grid.editCount();
+    finish(grid, state);
+    state.lastUpdateIncremental = true;
+    state.lastUpdateSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - began).count();
+}
@@ -0,0 +1,117 @@
+// ===================================================================================
+// == FILE: src/FlowField.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Header file for the flow field, a single search that serves any
+// number of agents heading for the same goal. A reverse Dijkstra from the End cell
+// fills an integration field (the cost from every cell to the goal) and, with it,
+// a direction field: the move each cell should take next. An agent anywhere on
+// the map then follows its cell's direction at O(1) per step. When walls or weights
+// are edited, only the cells whose route ran through an edited cell are searched
+// again.
+//
+// ===================================================================================
+#ifndef FLOWFIELD_H
+#define FLOWFIELD_H
+
+#include "GridModel.h"
+#include "Heuristics.h"
+#include "MonotoneQueue.h"
+#include <climits>
+#include <cstdint>
+#include <vector>
+
+// The moves a direction stands for: 0-3 straight (up, down, left, right), 4-7 diagonal,
+// in the same order as the searches' neighbour loops.
+const int FLOW_DR[8] = {-1, 1, 0, 0, -1, -1, 1, 1};
+const int FLOW_DC[8] = {0, 0, -1, 1, -1, 1, -1, 1};
+
+// The cost of a cell that cannot reach the goal.
+const int FLOW_UNREACHED = INT_MAX;
+
+/**
+ * @brief Holds the integration and direction fields and the search that builds them.
+ */
+struct FlowFieldState {
+    // --- Tuning ---
+    int cellsPerStep = 0;          // Cells settled per visual step (0 = one grid row's worth).
+
+    // What the field was built for; a different goal, size or connectivity, or edits
+    // the journal has dropped, need a full rebuild.
+    int goal = -1;
+    int builtCells = 0;
+    bool builtDiagonal = false;
+    std::uint64_t editsApplied = 0;
+    MoveCosts move = moveCosts(false); // Step costs, the same as Dijkstra's.
+
+    // cost[i]: the cheapest cost from cell i to the goal, or FLOW_UNREACHED.
+    // direction[i]: the move (an index into FLOW_DR/FLOW_DC) cell i takes towards the
+    // goal, or -1 for the goal itself, walls and cells that cannot reach it.
+    std::vector<int> cost;
+    std::vector<std::int8_t> direction;
+
+    MonotoneQueue queue;       // The reverse search's open set.
+    std::vector<int> invalid;  // Scratch for updates: cells whose route ran through an edit.
+
+    // --- State Flags ---
+    bool isSearching = false;
+    bool isComplete = false;
+    bool noPathExists = false; // The start cell cannot reach the goal.
+
+    // --- Visualization & Stats ---
+    int currentLine = 0;
+    int nodesVisited = 0;          // Cells settled by the build.
+    int pathCost = 0;              // The start cell's cost, in move.straight units per step.
+    int reachable = 0;             // Cells with a route to the goal.
+    int lastUpdateCells = 0;       // Cells the latest update settled.
+    bool lastUpdateIncremental = false;
+    double lastUpdateSeconds = 0.0;
+};
+
+/**
+ * @brief Starts building the field towards the grid's End cell.
+ * @param grid The map (only read: the field paints nothing).
+ * @param state The field to build.
+ * @param isDiagonal Whether diagonal moves are allowed.
+ */
+void startFlowField(const GridModel& grid, FlowFieldState& state, bool isDiagonal);
+
+/**
+ * @brief Settles the next batch of cells of the build, in order of cost.
+ */
+void flowFieldStep(const GridModel& grid, FlowFieldState& state, bool isDiagonal);
+
+/**
+ * @brief Resets the FlowFieldState to its initial condition, dropping the field.
+ */
+void resetFlowField(FlowFieldState& state);
+
+/**
+ * @brief True if walls, weights, the goal or the connectivity changed since the
+ * field was built or last updated.
+ */
+bool flowFieldStale(const GridModel& grid, const FlowFieldState& state, bool isDiagonal);
+
+/**
+ * @brief Brings a finished field up to date with the grid.
+ *
+ * Replays the edit journal: the cells whose route to the goal ran through an
+ * edited cell lose their cost, are re-seeded from their neighbours that kept
+ * theirs, and a reverse Dijkstra from those seeds and from the edited cells fixes
+ * up everything that changed. A moved goal, a new connectivity or a large batch
+ * of edits rebuilds the field from scratch instead.
+ */
+void updateFlowField(const GridModel& grid, FlowFieldState& state, bool isDiagonal);
+
+/**
+ * @brief The cell an agent on 'cell' moves to next, or -1 if it is on the goal or
+ * cannot reach it.
+ */
+inline int flowNext(const GridModel& grid, const FlowFieldState& state, int cell) {
+    int move = state.direction[cell];
+    return move < 0 ? -1 : cell + FLOW_DR[move] * grid.cols + FLOW_DC[move];
+}
+
+#endif // FLOWFIELD_H
@@ -1,226 +1,427 @@
 #include "Grid.h"
+#include <algorithm>
+#include <cmath>
 
 const sf::Color EMPTY_COLOR = sf::Color::White;
 const sf::Color START_COLOR = sf::Color::Green;
 const sf::Color END_COLOR = sf::Color::Red;
 const sf::Color WALL_COLOR = sf::Color(50, 50, 50);
 const sf::Color VISITED_COLOR = sf::Color(173, 216, 230);
+const sf::Color VISITED_WEIGHT_COLOR = sf::Color(135, 168, 182); // A "muddy blue"
 const sf::Color PATH_COLOR = sf::Color::Yellow;
 const sf::Color WEIGHT_COLOR = sf::Color(188, 143, 143);
+const sf::Color OPEN_COLOR = sf::Color(200, 255, 200);
+const sf::Color VISITED_BACK_COLOR = sf::Color(216, 191, 236);        // Backward frontier: lavender
+const sf::Color VISITED_BACK_WEIGHT_COLOR = sf::Color(170, 145, 190);
+const sf::Color OPEN_BACK_COLOR = sf::Color(255, 228, 196);
 const sf::Color GRID_LINE_COLOR = sf::Color(200, 200, 200);
+const sf::Color CLUSTER_LINE_COLOR = sf::Color(70, 130, 180, 200); // Steel blue, slightly see-through
 //Define colors, including one for the new Weight node
 
 /**
- * @brief ** UPDATED CONSTRUCTOR **
- * Now accepts a starting position (x, y).
+ * @brief Maps a cell's type (and cost, for visited "mud") to its fill color.
  */
-Grid::Grid(int x, int y, int width, int height, int nodeSize) : gridX(x), gridY(y), nodeSize(nodeSize) {
-    this->rows = height / nodeSize;
-    this->cols = width / nodeSize;
-
-    nodes.resize(rows);
-    for (int i = 0; i < rows; ++i) {
-        nodes[i].resize(cols);
-        for (int j = 0; j < cols; ++j) {
-            nodes[i][j].row = i;
-            nodes[i][j].col = j;
-            nodes[i][j].shape.setSize(sf::Vector2f(nodeSize, nodeSize));
-            // ** UPDATED POSITIONING **
-            nodes[i][j].shape.setPosition(gridX + j * nodeSize, gridY + i * nodeSize);
-            nodes[i][j].shape.setOutlineThickness(1);
-            nodes[i][j].shape.setOutlineColor(GRID_LINE_COLOR);
-            setNodeType(i, j, NodeType::Empty);
-        }
+static sf::Color colorFor(NodeType type, int cost) {
+    switch (type) {
+        case NodeType::Start:   return START_COLOR;
+        case NodeType::End:     return END_COLOR;
+        case NodeType::Wall:    return WALL_COLOR;
+        case NodeType::Visited: return cost > 1 ? VISITED_WEIGHT_COLOR : VISITED_COLOR;
+        case NodeType::Path:    return PATH_COLOR;
+        case NodeType::Weight:  return WEIGHT_COLOR;
+        case NodeType::Open:    return OPEN_COLOR;
+        case NodeType::VisitedBack: return cost > 1 ? VISITED_BACK_WEIGHT_COLOR : VISITED_BACK_COLOR;
+        case NodeType::OpenBack:    return OPEN_BACK_COLOR;
+        case NodeType::Empty:
+        default:                return EMPTY_COLOR;
     }
 }
 
-void Grid::draw(sf::RenderWindow& window) {
-    for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j < cols; ++j) {
-            window.draw(nodes[i][j].shape);
-        }
-    }
-}
+// Cells per side of a texture tile. Small enough for any GPU's texture size limit.
+const int TILE_SIZE = 512;
+
+// How far the view can zoom in, in world units per pixel (cells at 4x their size).
+const float MIN_ZOOM = 0.25f;
 
 /**
- * @brief ** UPDATED MOUSE HANDLING **
- * Now correctly calculates the row and column based on the grid's position.
+ * @brief ** UPDATED CONSTRUCTOR **
+ * Now accepts a starting position (x, y). The grid fills the area with as many
+ * cells of 'nodeSize' pixels as fit.
  */
-void Grid::handleMouseInput(sf::RenderWindow& window, bool weightsEnabled) {
-    if (sf::Mouse::getPosition(window).x > 1030) return;
+Grid::Grid(int x, int y, int width, int height, int nodeSize)
+    : Grid(x, y, width, height, height / nodeSize, width / nodeSize, nodeSize) {}
 
-    int mouseRow = (sf::Mouse::getPosition(window).y - gridY) / nodeSize;
-    int mouseCol = (sf::Mouse::getPosition(window).x - gridX) / nodeSize;
+Grid::Grid(int x, int y, int width, int height, int rows, int cols, int nodeSize)
+    : model(rows, cols), nodeSize(nodeSize), gridX(x), gridY(y), areaWidth(width), areaHeight(height) {
+    this->rows = model.rows;
+    this->cols = model.cols;
+    model.trackChanges = true;
+    buildTiles();
+    buildGridLines();
+    fitView();
+}
 
-    if (mouseRow < 0 || mouseRow >= rows || mouseCol < 0 || mouseCol >= cols) return;
+void Grid::resize(int newRows, int newCols) {
+    model.resize(newRows, newCols);
+    rebuild();
+}
 
-    if (sf::Mouse::isButtonPressed(sf::Mouse::Left)) {
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::W) && weightsEnabled) {
-            if (nodes[mouseRow][mouseCol].type == NodeType::Empty) {
-                setNodeType(mouseRow, mouseCol, NodeType::Weight);
-            }
-        }
-        else if (sf::Keyboard::isKeyPressed(sf::Keyboard::LShift)) {
-             if (nodes[mouseRow][mouseCol].type == NodeType::Empty) {
-                setNodeType(mouseRow, mouseCol, NodeType::Wall);
-            }
-        }
-        else {
-            if (nodes[mouseRow][mouseCol].type == NodeType::Empty) {
-                if (!startNode) {
-                    setNodeType(mouseRow, mouseCol, NodeType::Start);
-                } else if (!endNode) {
-                    setNodeType(mouseRow, mouseCol, NodeType::End);
-                }
-            }
+// Rebuilds the tiles, lines and view after the model changed size.
+void Grid::rebuild() {
+    rows = model.rows;
+    cols = model.cols;
+    clusterLinesSize = 0;
+    buildTiles();
+    buildGridLines();
+    fitView();
+}
+
+// Splits the grid into tiles and fills them with the empty color. The textures are
+// created on the first sync, once there is a window to draw in.
+void Grid::buildTiles() {
+    tilesAcross = (cols + TILE_SIZE - 1) / TILE_SIZE;
+    int tilesDown = (rows + TILE_SIZE - 1) / TILE_SIZE;
+    tiles.clear();
+    tiles.resize(static_cast<std::size_t>(tilesAcross) * tilesDown);
+    for (int t = 0; t < static_cast<int>(tiles.size()); ++t) {
+        Tile& tile = tiles[t];
+        tile.row0 = (t / tilesAcross) * TILE_SIZE;
+        tile.col0 = (t % tilesAcross) * TILE_SIZE;
+        tile.rows = std::min(TILE_SIZE, rows - tile.row0);
+        tile.cols = std::min(TILE_SIZE, cols - tile.col0);
+        tile.pixels.resize(static_cast<std::size_t>(tile.rows) * tile.cols * 4);
+        for (std::size_t p = 0; p < tile.pixels.size(); p += 4) {
+            tile.pixels[p] = EMPTY_COLOR.r;
+            tile.pixels[p + 1] = EMPTY_COLOR.g;
+            tile.pixels[p + 2] = EMPTY_COLOR.b;
+            tile.pixels[p + 3] = EMPTY_COLOR.a;
         }
+        tile.dirtyTop = 0;  // The whole tile is uploaded on the first sync.
+        tile.dirtyBottom = tile.rows - 1;
     }
+}
 
-    if (sf::Mouse::isButtonPressed(sf::Mouse::Right)) {
-        if (nodes[mouseRow][mouseCol].type == NodeType::Empty) {
-            setNodeType(mouseRow, mouseCol, NodeType::Wall);
-        }
+// The grid lines replace the per-cell outlines. They are only drawn while a cell
+// is big enough on screen to show a line without hiding the cell.
+void Grid::buildGridLines() {
+    gridLines.clear();
+    gridLines.setPrimitiveType(sf::Lines);
+    float right = static_cast<float>(cols * nodeSize);
+    float bottom = static_cast<float>(rows * nodeSize);
+    for (int i = 0; i <= rows; ++i) {
+        float y = static_cast<float>(i * nodeSize);
+        gridLines.append(sf::Vertex(sf::Vector2f(0, y), GRID_LINE_COLOR));
+        gridLines.append(sf::Vertex(sf::Vector2f(right, y), GRID_LINE_COLOR));
+    }
+    for (int j = 0; j <= cols; ++j) {
+        float x = static_cast<float>(j * nodeSize);
+        gridLines.append(sf::Vertex(sf::Vector2f(x, 0), GRID_LINE_COLOR));
+        gridLines.append(sf::Vertex(sf::Vector2f(x, bottom), GRID_LINE_COLOR));
     }
 }
 
-// ... (reset, resetWalls, clearPath, setNodeType functions remain the same)
-void Grid::reset() {
-    startNode = nullptr;
-    endNode = nullptr;
-    for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j < cols; ++j) {
-            setNodeType(i, j, NodeType::Empty);
+// Zooms out until the whole grid fits the area (never zooming in past 1:1).
+void Grid::fitView() {
+    zoomLevel = std::max({1.0f, static_cast<float>(cols * nodeSize) / areaWidth,
+                          static_cast<float>(rows * nodeSize) / areaHeight});
+    view.setSize(areaWidth * zoomLevel, areaHeight * zoomLevel);
+    view.setCenter(areaWidth * zoomLevel / 2, areaHeight * zoomLevel / 2);
+    clampView();
+}
+
+// Keeps the view over the grid: a grid narrower than the view is pinned to the
+// area's left/top edge, otherwise the view may not scroll past the grid's edges.
+void Grid::clampView() {
+    sf::Vector2f size = view.getSize();
+    sf::Vector2f center = view.getCenter();
+    float worldWidth = static_cast<float>(cols * nodeSize);
+    float worldHeight = static_cast<float>(rows * nodeSize);
+    center.x = size.x >= worldWidth ? size.x / 2 : std::max(size.x / 2, std::min(center.x, worldWidth - size.x / 2));
+    center.y = size.y >= worldHeight ? size.y / 2 : std::max(size.y / 2, std::min(center.y, worldHeight - size.y / 2));
+    view.setCenter(center);
+}
+
+// Places the view on the grid's screen area. The area is given in the window's
+// default view coordinates, which is what the rest of the UI is laid out in.
+void Grid::applyViewport(const sf::RenderWindow& window) {
+    sf::Vector2f screen = window.getDefaultView().getSize();
+    view.setViewport(sf::FloatRect(gridX / screen.x, gridY / screen.y, areaWidth / screen.x, areaHeight / screen.y));
+}
+
+void Grid::handleViewEvent(const sf::Event& event, sf::RenderWindow& window) {
+    applyViewport(window);
+    if (event.type == sf::Event::MouseWheelScrolled && event.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel) {
+        sf::Vector2i pixel(event.mouseWheelScroll.x, event.mouseWheelScroll.y);
+        sf::Vector2f ui = window.mapPixelToCoords(pixel);
+        if (!sf::FloatRect(gridX, gridY, areaWidth, areaHeight).contains(ui)) return;
+
+        float fit = std::max({1.0f, static_cast<float>(cols * nodeSize) / areaWidth,
+                              static_cast<float>(rows * nodeSize) / areaHeight});
+        float newZoom = zoomLevel * std::pow(0.8f, event.mouseWheelScroll.delta);
+        newZoom = std::max(MIN_ZOOM, std::min(newZoom, fit));
+
+        // Zoom around the cursor: the world point under it stays under it.
+        sf::Vector2f before = window.mapPixelToCoords(pixel, view);
+        view.setSize(areaWidth * newZoom, areaHeight * newZoom);
+        zoomLevel = newZoom;
+        sf::Vector2f after = window.mapPixelToCoords(pixel, view);
+        view.move(before - after);
+        clampView();
+    }
+    else if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Middle) {
+        sf::Vector2i pixel(event.mouseButton.x, event.mouseButton.y);
+        if (sf::FloatRect(gridX, gridY, areaWidth, areaHeight).contains(window.mapPixelToCoords(pixel))) {
+            panning = true;
+            panFrom = pixel;
+        }
+    }
+    else if (event.type == sf::Event::MouseButtonReleased && event.mouseButton.button == sf::Mouse::Middle) {
+        panning = false;
+    }
+    else if (event.type == sf::Event::MouseMoved && panning) {
+        sf::Vector2i pixel(event.mouseMove.x, event.mouseMove.y);
+        view.move(window.mapPixelToCoords(panFrom, view) - window.mapPixelToCoords(pixel, view));
+        panFrom = pixel;
+        clampView();
+    }
+    else if (event.type == sf::Event::KeyPressed) {
+        sf::Vector2f step = view.getSize() / 10.0f;  // Scroll a tenth of the view per key press.
+        switch (event.key.code) {
+            case sf::Keyboard::Left:  view.move(-step.x, 0); break;
+            case sf::Keyboard::Right: view.move(step.x, 0); break;
+            case sf::Keyboard::Up:    view.move(0, -step.y); break;
+            case sf::Keyboard::Down:  view.move(0, step.y); break;
+            case sf::Keyboard::Home:  fitView(); break;
+            default: return;
         }
+        clampView();
     }
 }
 
-void Grid::resetWalls() {
-    for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j < cols; ++j) {
-            if (nodes[i][j].type == NodeType::Wall) {
-                setNodeType(i, j, NodeType::Empty);
-            }
+int Grid::cellAtPixel(const sf::RenderWindow& window, sf::Vector2i pixel) const {
+    if (!sf::FloatRect(gridX, gridY, areaWidth, areaHeight).contains(window.mapPixelToCoords(pixel))) return -1;
+    sf::Vector2f world = window.mapPixelToCoords(pixel, view);
+    if (world.x < 0 || world.y < 0) return -1;
+    int row = static_cast<int>(world.y) / nodeSize;
+    int col = static_cast<int>(world.x) / nodeSize;
+    if (!model.isValid(row, col)) return -1;
+    return model.index(row, col);
+}
+
+// Writes each changed cell's color into its tile and uploads, per tile, only the
+// band of rows that changed.
+void Grid::sync() {
+    // Code that only sees the model (such as a map loader) may have resized it.
+    if (model.rows != rows || model.cols != cols) rebuild();
+
+    for (int index : model.changedCells) {
+        sf::Color color = colorFor(model.types[index], model.costs[index]);
+        int row = model.rowOf(index), col = model.colOf(index);
+        Tile& tile = tiles[(row / TILE_SIZE) * tilesAcross + col / TILE_SIZE];
+        int localRow = row - tile.row0;
+        sf::Uint8* texel = &tile.pixels[(static_cast<std::size_t>(localRow) * tile.cols + (col - tile.col0)) * 4];
+        texel[0] = color.r;
+        texel[1] = color.g;
+        texel[2] = color.b;
+        texel[3] = color.a;
+        if (tile.dirtyTop > tile.dirtyBottom) {
+            tile.dirtyTop = tile.dirtyBottom = localRow;
+        } else {
+            tile.dirtyTop = std::min(tile.dirtyTop, localRow);
+            tile.dirtyBottom = std::max(tile.dirtyBottom, localRow);
         }
     }
+    model.changedCells.clear();
+
+    for (Tile& tile : tiles) {
+        if (tile.dirtyTop > tile.dirtyBottom) continue;
+        if (tile.texture.getSize().x == 0) tile.texture.create(tile.cols, tile.rows);
+        tile.texture.update(&tile.pixels[static_cast<std::size_t>(tile.dirtyTop) * tile.cols * 4], tile.cols,
+                            tile.dirtyBottom - tile.dirtyTop + 1, 0, tile.dirtyTop);
+        tile.dirtyTop = 0;
+        tile.dirtyBottom = -1;
+    }
 }
 
-void Grid::clearPath() {
-    for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j < cols; ++j) {
-            sf::Color currentColor = nodes[i][j].shape.getFillColor();
-            if (currentColor != EMPTY_COLOR && currentColor != START_COLOR &&
-                currentColor != END_COLOR && currentColor != WALL_COLOR &&
-                currentColor != WEIGHT_COLOR)
-            {
-                if (nodes[i][j].cost > 1) {
-                    setNodeType(i, j, NodeType::Weight);
-                } else {
-                    setNodeType(i, j, NodeType::Empty);
-                }
-            }
-        }
+void Grid::draw(sf::RenderWindow& window) {
+    sync();
+    applyViewport(window);
+    window.setView(view);
+
+    // Only the tiles that overlap the view are drawn.
+    sf::FloatRect visible(view.getCenter() - view.getSize() / 2.0f, view.getSize());
+    for (const Tile& tile : tiles) {
+        sf::FloatRect bounds(static_cast<float>(tile.col0 * nodeSize), static_cast<float>(tile.row0 * nodeSize),
+                             static_cast<float>(tile.cols * nodeSize), static_cast<float>(tile.rows * nodeSize));
+        if (!visible.intersects(bounds)) continue;
+        sf::Sprite sprite(tile.texture);
+        sprite.setPosition(bounds.left, bounds.top);
+        sprite.setScale(static_cast<float>(nodeSize), static_cast<float>(nodeSize));
+        window.draw(sprite);
     }
+    if (nodeSize / zoomLevel >= 4) window.draw(gridLines);
+
+    window.setView(window.getDefaultView());
 }
 
-void Grid::clearWeights() {
-    for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j < cols; ++j) {
-            if (nodes[i][j].type == NodeType::Weight) {
-                setNodeType(i, j, NodeType::Empty);
-            }
+void Grid::drawClusterBorders(sf::RenderWindow& window, int clusterSize) {
+    if (clusterSize != clusterLinesSize) {
+        clusterLinesSize = clusterSize;
+        clusterLines.clear();
+        clusterLines.setPrimitiveType(sf::Quads);
+        float right = static_cast<float>(cols * nodeSize);
+        float bottom = static_cast<float>(rows * nodeSize);
+        const float half = 1.0f;  // Lines are two units wide, centred on the cell edge.
+
+        auto addQuad = [this](float left, float top, float width, float height) {
+            clusterLines.append(sf::Vertex(sf::Vector2f(left, top), CLUSTER_LINE_COLOR));
+            clusterLines.append(sf::Vertex(sf::Vector2f(left + width, top), CLUSTER_LINE_COLOR));
+            clusterLines.append(sf::Vertex(sf::Vector2f(left + width, top + height), CLUSTER_LINE_COLOR));
+            clusterLines.append(sf::Vertex(sf::Vector2f(left, top + height), CLUSTER_LINE_COLOR));
+        };
+        for (int i = clusterSize; i < rows; i += clusterSize) {
+            addQuad(0, i * nodeSize - half, right, 2 * half);
+        }
+        for (int j = clusterSize; j < cols; j += clusterSize) {
+            addQuad(j * nodeSize - half, 0, 2 * half, bottom);
         }
     }
+    applyViewport(window);
+    window.setView(view);
+    window.draw(clusterLines);
+    window.setView(window.getDefaultView());
 }
 
-// Fills the entire grid with walls to be "carved" out.
-void Grid::fillWithWalls() {
-    startNode = nullptr;
-    endNode = nullptr;
-    for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j < cols; ++j) {
-            setNodeType(i, j, NodeType::Wall);
+void Grid::drawFlowField(sf::RenderWindow& window, const FlowFieldState& field) {
+    // Below 8 pixels a cell the arrows blur into noise.
+    if (field.direction.size() != static_cast<std::size_t>(model.size()) || nodeSize / zoomLevel < 8) return;
+    applyViewport(window);
+
+    // Only the cells in view get an arrow, so the overlay costs the same on any grid.
+    sf::Vector2f topLeft = view.getCenter() - view.getSize() / 2.0f;
+    int firstRow = std::max(0, static_cast<int>(topLeft.y / nodeSize));
+    int firstCol = std::max(0, static_cast<int>(topLeft.x / nodeSize));
+    int lastRow = std::min(rows - 1, static_cast<int>((topLeft.y + view.getSize().y) / nodeSize));
+    int lastCol = std::min(cols - 1, static_cast<int>((topLeft.x + view.getSize().x) / nodeSize));
+
+    int highest = 1;
+    for (int r = firstRow; r <= lastRow; ++r) {
+        for (int c = firstCol; c <= lastCol; ++c) {
+            int cost = field.cost[model.index(r, c)];
+            if (cost != FLOW_UNREACHED) highest = std::max(highest, cost);
         }
     }
-}
 
-// A simple bounds check.
-bool Grid::isValid(int r, int c) {
-    return r >= 0 && r < rows && c >= 0 && c < cols;
-}
+    flowArrows.clear();
+    flowArrows.setPrimitiveType(sf::Lines);
+    const float shaft = 0.35f * nodeSize;  // Half the arrow's length.
+    const float head = 0.2f * nodeSize;
+    for (int r = firstRow; r <= lastRow; ++r) {
+        for (int c = firstCol; c <= lastCol; ++c) {
+            int cell = model.index(r, c);
+            int move = field.direction[cell];
+            if (move < 0) continue;
+            float heat = static_cast<float>(field.cost[cell]) / highest;
+            sf::Color color(static_cast<sf::Uint8>(220 * heat), 40, static_cast<sf::Uint8>(220 * (1.0f - heat)));
 
-void Grid::finalizeMaze() {
-    for (auto& row : nodes) {
-        for (auto& node : row) {
-            if (node.type == NodeType::Visited) {
-                setNodeType(node.row, node.col, NodeType::Empty);
+            // The unit vector of the move, its perpendicular, and the arrow's ends.
+            float dx = static_cast<float>(FLOW_DC[move]), dy = static_cast<float>(FLOW_DR[move]);
+            if (move >= 4) {
+                dx *= 0.7071f;
+                dy *= 0.7071f;
             }
+            sf::Vector2f center((c + 0.5f) * nodeSize, (r + 0.5f) * nodeSize);
+            sf::Vector2f tip(center.x + dx * shaft, center.y + dy * shaft);
+            sf::Vector2f tail(center.x - dx * shaft, center.y - dy * shaft);
+            sf::Vector2f back(tip.x - dx * head, tip.y - dy * head);
+            sf::Vector2f side(-dy * head * 0.6f, dx * head * 0.6f);
+
+            flowArrows.append(sf::Vertex(tail, color));
+            flowArrows.append(sf::Vertex(tip, color));
+            flowArrows.append(sf::Vertex(tip, color));
+            flowArrows.append(sf::Vertex(sf::Vector2f(back.x + side.x, back.y + side.y), color));
+            flowArrows.append(sf::Vertex(tip, color));
+            flowArrows.append(sf::Vertex(sf::Vector2f(back.x - side.x, back.y - side.y), color));
         }
     }
+    window.setView(view);
+    window.draw(flowArrows);
+    window.setView(window.getDefaultView());
 }
 
-void Grid::clearMaze() {
-    for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j < cols; ++j) {
-            // If the node is NOT the start or end point, reset it to empty.
-            if (&nodes[i][j] != startNode && &nodes[i][j] != endNode) {
-                setNodeType(i, j, NodeType::Empty);
+/**
+ * @brief ** UPDATED MOUSE HANDLING **
+ * Now maps the mouse through the grid's view, so the cell under the cursor is found
+ * at any zoom and pan.
+ *
+ * When 'editSearchedCells' is set, cells painted by a search count as the empty or
+ * weighted cell underneath, so walls can be drawn over a finished search (used by
+ * LPA*, which repairs its path after such edits).
+ */
+void Grid::handleMouseInput(sf::RenderWindow& window, bool weightsEnabled, bool editSearchedCells) {
+    int cell = cellAtPixel(window, sf::Mouse::getPosition(window));
+    if (cell < 0) return;
+    int mouseRow = model.rowOf(cell);
+    int mouseCol = model.colOf(cell);
+
+    NodeType current = model.types[cell];
+    if (editSearchedCells && isSearchMarker(current)) {
+        current = model.costs[cell] > 1 ? NodeType::Weight : NodeType::Empty;
+    }
+
+    if (sf::Mouse::isButtonPressed(sf::Mouse::Left)) {
+        if (sf::Keyboard::isKeyPressed(sf::Keyboard::W) && weightsEnabled) {
+            if (current == NodeType::Empty) {
+                setNodeType(mouseRow, mouseCol, NodeType::Weight);
             }
         }
+        else if (sf::Keyboard::isKeyPressed(sf::Keyboard::LShift)) {
+             if (current == NodeType::Empty) {
+                setNodeType(mouseRow, mouseCol, NodeType::Wall);
+            }
+        }
+        else {
+            if (current == NodeType::Empty) {
+                if (model.startIndex < 0) {
+                    setNodeType(mouseRow, mouseCol, NodeType::Start);
+                } else if (model.endIndex < 0) {
+                    setNodeType(mouseRow, mouseCol, NodeType::End);
+                }
+            }
+        }
+    }
+
+    if (sf::Mouse::isButtonPressed(sf::Mouse::Right)) {
+        if (current == NodeType::Empty) {
+            setNodeType(mouseRow, mouseCol, NodeType::Wall);
+        }
     }
 }
 
+// The whole-grid edits live in the model; the view picks the changes up in sync().
+void Grid::reset() { model.reset(); }
+void Grid::resetWalls() { model.resetWalls(); }
+void Grid::clearPath() { model.clearPath(); }
+void Grid::clearWeights() { model.clearWeights(); }
+void Grid::fillWithWalls() { model.fillWithWalls(); }
+void Grid::finalizeMaze() { model.finalizeMaze(); }
+void Grid::clearMaze() { model.clearMaze(); }
+
+// A simple bounds check.
+bool Grid::isValid(int r, int c) {
+    return model.isValid(r, c);
+}
+
 /**
  * @brief Sets the type of a specific node and updates its visual and logical state.
  *
- * This is a critical helper function that handles all node transformations. It updates
- * the node's type, color, and cost. It also correctly manages the main startNode and
- * endNode pointers for the grid, ensuring there is only ever one of each.
+ * The model updates the node's type, cost and the grid's start/end indices (there
+ * is only ever one of each); the new color is applied on the next sync().
  *
  * @param row The row index of the node to change.
  * @param col The column index of the node to change.
  * @param type The new NodeType to assign to the node.
  */
 void Grid::setNodeType(int row, int col, NodeType type) {
-    // Before changing the node, check if it's currently the start or end node.
-    // If it is, we must nullify the main pointer to it to prevent dangling pointers.
-    if (&nodes[row][col] == startNode) {
-        startNode = nullptr;
-    }
-    if (&nodes[row][col] == endNode) {
-        endNode = nullptr;
-    }
-
-    // Set the node's new type and reset its movement cost to the default value.
-    nodes[row][col].type = type;
-
-    // Use a switch statement to handle the specific logic for each node type.
-    switch (type) {
-        case NodeType::Empty:
-            nodes[row][col].shape.setFillColor(EMPTY_COLOR);
-            nodes[row][col].cost = 1;
-            break;
-        case NodeType::Start:
-            nodes[row][col].shape.setFillColor(START_COLOR);
-            nodes[row][col].cost = 1;
-            startNode = &nodes[row][col];  // Assign this node as the grid's official start point.
-            break;
-        case NodeType::End:
-            nodes[row][col].shape.setFillColor(END_COLOR);
-            nodes[row][col].cost = 1;
-            endNode = &nodes[row][col];    // Assign this node as the grid's official end point.
-            break;
-        case NodeType::Wall:
-            nodes[row][col].shape.setFillColor(WALL_COLOR);
-            nodes[row][col].cost = 1;
-            break;
-        case NodeType::Visited:
-            break;
-        case NodeType::Path:
-            nodes[row][col].shape.setFillColor(PATH_COLOR);
-            break;
-        case NodeType::Weight:
-            nodes[row][col].shape.setFillColor(WEIGHT_COLOR);
-            nodes[row][col].cost = 5;      // Weighted "mud" nodes have a higher movement cost.
-            break;
-    }
+    model.setType(model.index(row, col), type);
 }
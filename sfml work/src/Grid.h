@@ -3,27 +3,29 @@
 //
 // AUTHOR: Arpit Jatav
 //
-// DESCRIPTION: Defines the Grid class, which manages the 2D grid of nodes for the
-// pathfinding mode. It handles the creation, drawing, user interaction (placing
-// walls, start/end nodes), and state of the pathfinding environment.
+// DESCRIPTION: Defines the Grid class, the on-screen view of the pathfinding
+// environment. The cell data itself lives in a render-free GridModel; the Grid
+// draws it through an sf::View that can be zoomed and panned over a fixed area of
+// the window, syncs the cell colors from the model's change list, and turns mouse
+// input into model edits (placing walls, start/end nodes).
 // ===================================================================================
 #ifndef GRID_H
 #define GRID_H
 
 #include <SFML/Graphics.hpp>
+#include <cstddef>
 #include <vector>
-
-enum class NodeType { Empty, Start, End, Wall, Visited, Path, Weight };
-
-struct Node {
-    sf::RectangleShape shape;
-    NodeType type = NodeType::Empty;
-    int row, col;
-    int cost = 1;
-};
+#include "FlowField.h"
+#include "GridModel.h"
 
 /**
- * @brief Manages the 2D grid for the pathfinding visualizer.
+ * @brief Draws and edits a GridModel for the pathfinding visualizer.
+ *
+ * The number of cells is independent of the screen area the grid is shown in: the
+ * grid lives in its own world space ('nodeSize' units per cell) and a view maps
+ * part of it onto the area. Cell colors are kept one texel per cell in square
+ * tiles of textures, so a 4096x4096 grid costs 4 bytes per cell on top of the
+ * model instead of a quad of vertices per cell.
  */
 
 class Grid {
@@ -31,8 +33,17 @@ public:
     // ** UPDATED CONSTRUCTOR **
     Grid(int x, int y, int width, int height, int nodeSize);
 
+    /**
+     * @brief Creates a grid of 'rows' x 'cols' cells shown in the given screen area.
+     * @param x, y The top-left corner of the screen area.
+     * @param width, height The size of the screen area, in pixels.
+     * @param rows, cols The size of the grid, in cells.
+     * @param nodeSize The size of a cell, in pixels, when the view is not zoomed.
+     */
+    Grid(int x, int y, int width, int height, int rows, int cols, int nodeSize);
+
     void draw(sf::RenderWindow& window);
-    void handleMouseInput(sf::RenderWindow& window, bool weightsEnabled);
+    void handleMouseInput(sf::RenderWindow& window, bool weightsEnabled, bool editSearchedCells = false);
     void reset();
     void resetWalls();
     void clearMaze();
@@ -50,14 +61,89 @@ public:
     void setNodeType(int row, int col, NodeType type);
     void finalizeMaze();
 
-    std::vector<std::vector<Node>> nodes;
-    Node* startNode = nullptr;
-    Node* endNode = nullptr;
+    /**
+     * @brief Replaces the grid with an empty one of a new size and zooms out to fit it.
+     * @param newRows The new number of rows.
+     * @param newCols The new number of columns.
+     */
+    void resize(int newRows, int newCols);
+
+    /**
+     * @brief Zooms and pans the view: the mouse wheel zooms around the cursor,
+     * dragging with the middle button pans, the arrow keys scroll and Home zooms out
+     * to show the whole grid.
+     * @param event The event to handle (anything else is ignored).
+     * @param window The window the grid is drawn in.
+     */
+    void handleViewEvent(const sf::Event& event, sf::RenderWindow& window);
+
+    /**
+     * @brief Finds the cell under a pixel of the window, taking the view into account.
+     * @return The cell's index, or -1 if the pixel is outside the grid area or the grid.
+     */
+    int cellAtPixel(const sf::RenderWindow& window, sf::Vector2i pixel) const;
+
+    /**
+     * @brief Recolors every cell the model has changed since the last sync. Called
+     * automatically by draw().
+     */
+    void sync();
+
+    /**
+     * @brief Draws the borders of square clusters of cells over the grid (the HPA*
+     * overlay). The lines are built once per cluster size.
+     * @param window The window to draw to.
+     * @param clusterSize The side of a cluster, in cells.
+     */
+    void drawClusterBorders(sf::RenderWindow& window, int clusterSize);
+
+    /**
+     * @brief Draws a flow field's directions over the grid, one arrow per visible
+     * cell, shaded from blue next to the goal to red for the costliest visible cell.
+     * Nothing is drawn while the cells are too small on screen for an arrow.
+     * @param window The window to draw to.
+     * @param field A built (or partly built) flow field for this grid.
+     */
+    void drawFlowField(sf::RenderWindow& window, const FlowFieldState& field);
+
+    // Fixed bytes a cell costs in memory: the model's bytes plus the view's texel copy
+    // (the texture on the GPU holds one more of those). The model's change lists are
+    // extra and vary; see GridModel::listBytes().
+    static constexpr int BYTES_PER_CELL = GridModel::BYTES_PER_CELL + 4;
+
+    GridModel model;  // The render-free cell data the algorithms run on.
     int rows, cols;
 
 private:
+    // A square block of cells drawn as one texture, one texel per cell.
+    struct Tile {
+        int row0 = 0, col0 = 0;       // The tile's top-left cell.
+        int rows = 0, cols = 0;       // Its size in cells (smaller at the grid's edges).
+        std::vector<sf::Uint8> pixels; // RGBA per cell, row-major within the tile.
+        sf::Texture texture;
+        int dirtyTop = 0, dirtyBottom = -1; // Rows (within the tile) to upload on the next sync.
+    };
+
+    void rebuild();
+    void buildTiles();
+    void buildGridLines();
+    void clampView();
+    void fitView();
+    void applyViewport(const sf::RenderWindow& window);
+
+    std::vector<Tile> tiles;
+    int tilesAcross = 0;        // Tiles per row of tiles.
+    sf::VertexArray gridLines;  // The grid lines, drawn as a separate line batch.
+    sf::VertexArray clusterLines;  // Thin quads along the cluster borders of the HPA* overlay.
+    int clusterLinesSize = 0;      // Cluster size 'clusterLines' was built for (0 = not built).
+    sf::VertexArray flowArrows;    // The flow field overlay, rebuilt for the visible cells each frame.
     int nodeSize;
     int gridX, gridY; // Store the top-left position
+    int areaWidth, areaHeight;  // The screen area the view is shown in.
+    sf::View view;               // The part of the grid's world shown in the area.
+    float zoomLevel = 1.0f;      // World units per screen pixel (1 = cells are nodeSize pixels).
+    bool panning = false;        // True while the middle button drags the view.
+    sf::Vector2i panFrom;        // Pixel the last pan movement started at.
 };
 
-#endif // GRID_H
\ No newline at end of file
+#endif // GRID_H
@@ -0,0 +1,145 @@
+// ===================================================================================
+// == FILE: src/GridModel.cpp ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Implements the render-free grid model: cell type/cost bookkeeping
+// and the whole-grid edits (reset, clear path, fill with walls, ...) used by both
+// the SFML view and headless code.
+//
+// ===================================================================================
+#include "GridModel.h"
+
+GridModel::GridModel(int rows, int cols)
+    : types(rows * cols, NodeType::Empty), costs(rows * cols, 1), rows(rows), cols(cols) {}
+
+void GridModel::resize(int newRows, int newCols) {
+    rows = newRows;
+    cols = newCols;
+    types.assign(size(), NodeType::Empty);
+    costs.assign(size(), 1);
+    types.shrink_to_fit();
+    costs.shrink_to_fit();
+    startIndex = -1;
+    endIndex = -1;
+    wallVersion++;
+    editsBase += edits.size() + 1;  // Readers now sit below 'editsBase' and start over.
+    edits.clear();
+    searchCells.clear();
+    // A view mirroring the model is rebuilt along with it, so nothing is left to sync.
+    changedCells.clear();
+}
+
+/**
+ * @brief Sets the type of a cell and updates its logical state.
+ *
+ * Mirrors the rules the grid has always used: placing a Start or End moves the
+ * grid's single start/end index, walls and empty cells reset the cost to 1, weights
+ * raise it to 5, and the search markers (Visited, Path, Open, ...) keep the cost so that
+ * clearing a path can restore weighted cells.
+ */
+void GridModel::setType(int index, NodeType type) {
+    // If this cell is currently the start or end, forget it before it changes.
+    if (index == startIndex) startIndex = -1;
+    if (index == endIndex) endIndex = -1;
+
+    // Remember the first time a search paints this cell, so clearPath() can find it.
+    if (isSearchMarker(type) && !isSearchMarker(types[index])) {
+        searchCells.push_back(index);
+    }
+    bool wallChanged = (types[index] == NodeType::Wall) != (type == NodeType::Wall);
+    if (wallChanged) wallVersion++;
+    std::uint8_t oldCost = costs[index];
+    types[index] = type;
+
+    switch (type) {
+        case NodeType::Empty:
+        case NodeType::Wall:
+            costs[index] = 1;
+            break;
+        case NodeType::Start:
+            costs[index] = 1;
+            startIndex = index;
+            break;
+        case NodeType::End:
+            costs[index] = 1;
+            endIndex = index;
+            break;
+        case NodeType::Weight:
+            costs[index] = WEIGHT_COST;  // Weighted "mud" nodes have a higher movement cost.
+            break;
+        case NodeType::Visited:
+        case NodeType::Path:
+        case NodeType::Open:
+        case NodeType::VisitedBack:
+        case NodeType::OpenBack:
+            break;
+    }
+
+    if (wallChanged || costs[index] != oldCost) {
+        if (edits.size() >= static_cast<std::size_t>(size())) {
+            editsBase += edits.size();
+            edits.clear();
+        }
+        edits.push_back(index);
+    }
+
+    if (trackChanges) changedCells.push_back(index);
+}
+
+void GridModel::reset() {
+    for (int i = 0; i < size(); ++i) setType(i, NodeType::Empty);
+    searchCells.clear();
+}
+
+void GridModel::resetWalls() {
+    for (int i = 0; i < size(); ++i) {
+        if (types[i] == NodeType::Wall) setType(i, NodeType::Empty);
+    }
+}
+
+// Turns every search marker (visited, path, open set) back into the cell underneath.
+// Only the cells recorded in 'searchCells' are touched, not the whole grid.
+void GridModel::clearPath() {
+    for (int i : searchCells) {
+        if (isSearchMarker(types[i])) {
+            types[i] = NodeType::Empty;  // Drop the marker first so setType() doesn't re-record it.
+            setType(i, costs[i] > 1 ? NodeType::Weight : NodeType::Empty);
+        }
+    }
+    searchCells.clear();
+}
+
+void GridModel::clearWeights() {
+    for (int i = 0; i < size(); ++i) {
+        if (types[i] == NodeType::Weight) setType(i, NodeType::Empty);
+    }
+}
+
+// Fills the entire grid with walls to be "carved" out.
+void GridModel::fillWithWalls() {
+    for (int i = 0; i < size(); ++i) setType(i, NodeType::Wall);
+    searchCells.clear();
+}
+
+// Turns visited cells back into empty ones, keeping any other search markers.
+void GridModel::finalizeMaze() {
+    std::vector<int> stillMarked;
+    for (int i : searchCells) {
+        if (types[i] == NodeType::Visited) {
+            setType(i, NodeType::Empty);
+        } else if (isSearchMarker(types[i])) {
+            stillMarked.push_back(i);
+        }
+    }
+    searchCells.swap(stillMarked);
+}
+
+void GridModel::clearMaze() {
+    for (int i = 0; i < size(); ++i) {
+        // If the cell is NOT the start or end point, reset it to empty.
+        if (i != startIndex && i != endIndex) setType(i, NodeType::Empty);
+    }
+    searchCells.clear();
+}
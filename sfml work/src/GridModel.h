@@ -0,0 +1,130 @@
+// ===================================================================================
+// == FILE: src/GridModel.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Defines the GridModel class, the render-free data model behind the
+// pathfinding grid. Every per-cell field lives in its own contiguous array and a
+// cell is addressed by a single index (row * cols + col), so the search algorithms
+// can run without SFML and a large map stays small enough to remain in cache.
+//
+// ===================================================================================
+#ifndef GRIDMODEL_H
+#define GRIDMODEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// 'Open' marks cells waiting in a priority queue (the green "open set" cells).
+// 'VisitedBack' and 'OpenBack' are the same markers for the backward frontier of a
+// bidirectional search, so the two frontiers can be told apart.
+enum class NodeType : std::uint8_t { Empty, Start, End, Wall, Visited, Path, Weight, Open, VisitedBack, OpenBack };
+
+// The movement cost of a Weight ("mud") cell; every other cell costs 1. Searches use
+// it as the largest single step a path's cost can take.
+const std::uint8_t WEIGHT_COST = 5;
+
+// True for the types a search paints over the map (visited, live path, open set).
+inline bool isSearchMarker(NodeType type) {
+    return type == NodeType::Visited || type == NodeType::Path || type == NodeType::Open ||
+           type == NodeType::VisitedBack || type == NodeType::OpenBack;
+}
+
+/**
+ * @brief Structure-of-arrays storage for the pathfinding grid.
+ *
+ * A cell costs two bytes (its type and its movement cost); its row and column are
+ * implied by its index. The model knows nothing about drawing: a view that wants
+ * to mirror it turns on 'trackChanges' and drains 'changedCells' once per frame.
+ */
+class GridModel {
+public:
+    GridModel(int rows, int cols);
+
+    // --- Index Helpers ---
+    int index(int row, int col) const { return row * cols + col; }
+    int rowOf(int index) const { return index / cols; }
+    int colOf(int index) const { return index % cols; }
+    int size() const { return rows * cols; }
+    bool isValid(int r, int c) const { return r >= 0 && r < rows && c >= 0 && c < cols; }
+    // True if the diagonal move from (r, c) by (dr, dc) passes a wall on either side.
+    bool cutsCorner(int r, int c, int dr, int dc) const {
+        return types[index(r + dr, c)] == NodeType::Wall || types[index(r, c + dc)] == NodeType::Wall;
+    }
+
+    // Fixed bytes of storage per cell: one for its type and one for its cost. The
+    // change lists below come on top; see listBytes().
+    static constexpr int BYTES_PER_CELL = sizeof(NodeType) + sizeof(std::uint8_t);
+
+    /**
+     * @brief Replaces the grid with an empty one of a new size.
+     *
+     * The wall version is bumped and the edit journal is dropped (counting one extra
+     * entry), so every algorithm that keeps data built from the old map rebuilds it.
+     * @param newRows The new number of rows.
+     * @param newCols The new number of columns.
+     */
+    void resize(int newRows, int newCols);
+
+    /**
+     * @brief Sets the type of a cell and updates its cost and the start/end indices.
+     * @param index The index of the cell to change.
+     * @param type The new NodeType to assign to the cell.
+     */
+    void setType(int index, NodeType type);
+
+    // --- Whole-Grid Edits ---
+    void reset();
+    void resetWalls();
+    void clearMaze();
+    void clearPath();
+    void clearWeights();
+    void fillWithWalls();
+    void finalizeMaze();
+
+    std::vector<NodeType> types;      // One byte per cell.
+    std::vector<std::uint8_t> costs;  // The cost of entering each cell (1, or WEIGHT_COST for weights).
+    int startIndex = -1;              // Index of the Start cell, or -1 if none is placed.
+    int endIndex = -1;                // Index of the End cell, or -1 if none is placed.
+    int rows, cols;
+
+    // Bumped whenever a cell turns into a wall or stops being one, so algorithms that
+    // precompute data from the wall layout (such as JPS+) know when to rebuild it.
+    std::uint64_t wallVersion = 0;
+
+    // The terrain edit journal: cells whose wall-ness or movement cost changed, oldest
+    // first. Incremental searches (LPA*) remember how many edits they have applied
+    // and replay only the newer ones. Once the journal outgrows the grid it is
+    // dropped and 'editsBase' counts the dropped entries, so a reader whose count is
+    // below it knows it missed edits and has to start over.
+    std::vector<int> edits;
+    std::uint64_t editsBase = 0;
+    std::uint64_t editCount() const { return editsBase + edits.size(); }
+
+    // The grid's content version: it changes whenever a wall or a weight is placed or
+    // removed (or the grid is resized) and never goes back, so a search result tagged
+    // with it is still valid while it is unchanged. It is the journal's edit count;
+    // painting and clearing search markers leave it alone.
+    std::uint64_t contentVersion() const { return editCount(); }
+
+    // Cells a search has painted since the last clearPath(). Clearing a path only
+    // visits these instead of sweeping the whole grid.
+    std::vector<int> searchCells;
+
+    // --- Change Tracking (for views) ---
+    bool trackChanges = false;        // When true, every setType() records its index below.
+    std::vector<int> changedCells;    // Cells modified since the view last synced.
+
+    /**
+     * @brief The bytes the edit journal, 'searchCells' and 'changedCells' hold right
+     * now (their capacity). Each can grow to about an int per cell before it is
+     * cleared, so together they can outweigh the fixed BYTES_PER_CELL several times.
+     */
+    std::size_t listBytes() const {
+        return (edits.capacity() + searchCells.capacity() + changedCells.capacity()) * sizeof(int);
+    }
+};
+
+#endif // GRIDMODEL_H
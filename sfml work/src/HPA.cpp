@@ -0,0 +1,510 @@
+// ===================================================================================
+// == FILE: src/HPA.cpp ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Implements HPA*: building and lazily repairing the cluster
+// hierarchy, the step-by-step abstract search and the refinement of the abstract
+// path into grid cells.
+//
+// ===================================================================================
+#include "HPA.h"
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <functional>
+
+static const int INF = INT_MAX / 2; // Large enough for any path, small enough to add a cost to.
+
+// Direction deltas in the order every algorithm uses: up, down, left, right, then diagonals.
+static const int DR[] = {-1, 1, 0, 0, -1, -1, 1, 1};
+static const int DC[] = {0, 0, -1, 1, -1, 1, -1, 1};
+
+// Entrances at least this wide get a transition at each end instead of one in the middle.
+static const int WIDE_ENTRANCE = 6;
+
+// Manhattan distance without diagonals, octile distance with them, in the same step
+// costs as A*.
+static int heuristic(const GridModel& grid, int a, int b, MoveCosts move) {
+    int dr = std::abs(grid.rowOf(a) - grid.rowOf(b));
+    int dc = std::abs(grid.colOf(a) - grid.colOf(b));
+    return heuristicCost(HeuristicKind::Octile, dr, dc, move);
+}
+
+static bool isOpen(const GridModel& grid, int r, int c) {
+    return grid.isValid(r, c) && grid.types[grid.index(r, c)] != NodeType::Wall;
+}
+
+static int clusterOf(const GridModel& grid, const HPAState& state, int cell) {
+    return (grid.rowOf(cell) / state.clusterSize) * state.clusterCols + grid.colOf(cell) / state.clusterSize;
+}
+
+static int localIndex(const GridModel& grid, const HPACluster& cluster, int cell) {
+    return (grid.rowOf(cell) - cluster.row0) * cluster.cols + (grid.colOf(cell) - cluster.col0);
+}
+
+/**
+ * @brief A* (or Dijkstra, without a target) restricted to the cells of one cluster.
+ *
+ * Fills state.localDist and state.localParent for the cluster's cells. With
+ * 'reverse' set the costs are those of walking each move backwards, so localDist
+ * holds the cost from every cell *to* the source instead.
+ * @param canvas The grid to paint expanded cells on (when refining a path), or nullptr.
+ * @return The number of cells expanded.
+ */
+static int localSearch(const GridModel& grid, HPAState& state, const HPACluster& cluster, int source, int target,
+                       bool reverse, bool isDiagonal, GridModel* canvas) {
+    int cellCount = cluster.rows * cluster.cols;
+    state.localDist.assign(cellCount, INF);
+    state.localParent.assign(cellCount, -1);
+    state.localClosed.assign(cellCount, 0);
+    state.localHeap.clear();
+
+    MoveCosts move = moveCosts(isDiagonal);
+    state.localDist[localIndex(grid, cluster, source)] = 0;
+    state.localHeap.push_back({source, target >= 0 ? heuristic(grid, source, target, move) : 0});
+
+    int expanded = 0;
+    int numDirections = isDiagonal ? 8 : 4;
+    while (!state.localHeap.empty()) {
+        std::pop_heap(state.localHeap.begin(), state.localHeap.end(), std::greater<HPANode>());
+        int current = state.localHeap.back().node;
+        state.localHeap.pop_back();
+        int local = localIndex(grid, cluster, current);
+        if (state.localClosed[local]) continue;
+        state.localClosed[local] = 1;
+        expanded++;
+
+        NodeType type = grid.types[current];
+        if (canvas && type != NodeType::Start && type != NodeType::End && type != NodeType::Path) {
+            canvas->setType(current, NodeType::Visited);
+        }
+        if (current == target) break;
+
+        int r = grid.rowOf(current);
+        int c = grid.colOf(current);
+        for (int i = 0; i < numDirections; ++i) {
+            int new_r = r + DR[i];
+            int new_c = c + DC[i];
+            if (new_r < cluster.row0 || new_r >= cluster.row0 + cluster.rows ||
+                new_c < cluster.col0 || new_c >= cluster.col0 + cluster.cols) continue;
+            int neighbor = grid.index(new_r, new_c);
+            if (grid.types[neighbor] == NodeType::Wall) continue;
+
+            int neighborLocal = localIndex(grid, cluster, neighbor);
+            int step = i < 4 ? move.straight : move.diagonal;
+            int g = state.localDist[local] + (reverse ? grid.costs[current] : grid.costs[neighbor]) * step;
+            if (g < state.localDist[neighborLocal]) {
+                state.localDist[neighborLocal] = g;
+                state.localParent[neighborLocal] = current;
+                int h = target >= 0 ? heuristic(grid, neighbor, target, move) : 0;
+                state.localHeap.push_back({neighbor, g + h});
+                std::push_heap(state.localHeap.begin(), state.localHeap.end(), std::greater<HPANode>());
+            }
+        }
+    }
+    return expanded;
+}
+
+// Adds the transitions for one maximal run of open cell pairs along a straight border:
+// one in the middle of a narrow run, one at each end of a wide one.
+static void addEntrance(std::vector<HPATransition>& out, const std::vector<HPATransition>& run) {
+    if (run.empty()) return;
+    if (static_cast<int>(run.size()) < WIDE_ENTRANCE) {
+        out.push_back(run[run.size() / 2]);
+    } else {
+        out.push_back(run.front());
+        out.push_back(run.back());
+    }
+}
+
+/**
+ * @brief Scans the borders cluster k shares with its right, lower, lower-right and
+ * lower-left neighbours for transitions.
+ *
+ * Straight crossings are grouped into entrances. A diagonal move across a border is
+ * only needed when both cells it squeezes between are walls; otherwise the same
+ * crossing can be made with two straight moves through an entrance (at 200 rather
+ * than 141, one of the ways HPA* trades path length for a smaller abstract graph).
+ */
+static void scanBorders(const GridModel& grid, const HPAState& state, int k, bool isDiagonal,
+                        std::vector<HPATransition> (&out)[4]) {
+    const HPACluster& cluster = state.clusters[k];
+    int cr = k / state.clusterCols;
+    int cc = k % state.clusterCols;
+    for (auto& border : out) border.clear();
+    std::vector<HPATransition> run;
+
+    // Right border: column x against column x + 1.
+    if (cc + 1 < state.clusterCols) {
+        int x = cluster.col0 + cluster.cols - 1;
+        int last = cluster.row0 + cluster.rows - 1;
+        run.clear();
+        for (int r = cluster.row0; r <= last; ++r) {
+            if (isOpen(grid, r, x) && isOpen(grid, r, x + 1)) {
+                run.push_back({grid.index(r, x), grid.index(r, x + 1)});
+            } else {
+                addEntrance(out[0], run);
+                run.clear();
+            }
+        }
+        addEntrance(out[0], run);
+        for (int r = cluster.row0; isDiagonal && r < last; ++r) {
+            if (isOpen(grid, r, x) && isOpen(grid, r + 1, x + 1) && !isOpen(grid, r, x + 1) && !isOpen(grid, r + 1, x)) {
+                out[0].push_back({grid.index(r, x), grid.index(r + 1, x + 1)});
+            }
+            if (isOpen(grid, r + 1, x) && isOpen(grid, r, x + 1) && !isOpen(grid, r, x) && !isOpen(grid, r + 1, x + 1)) {
+                out[0].push_back({grid.index(r + 1, x), grid.index(r, x + 1)});
+            }
+        }
+    }
+
+    // Lower border: row y against row y + 1.
+    if (cr + 1 < state.clusterRows) {
+        int y = cluster.row0 + cluster.rows - 1;
+        int last = cluster.col0 + cluster.cols - 1;
+        run.clear();
+        for (int c = cluster.col0; c <= last; ++c) {
+            if (isOpen(grid, y, c) && isOpen(grid, y + 1, c)) {
+                run.push_back({grid.index(y, c), grid.index(y + 1, c)});
+            } else {
+                addEntrance(out[1], run);
+                run.clear();
+            }
+        }
+        addEntrance(out[1], run);
+        for (int c = cluster.col0; isDiagonal && c < last; ++c) {
+            if (isOpen(grid, y, c) && isOpen(grid, y + 1, c + 1) && !isOpen(grid, y, c + 1) && !isOpen(grid, y + 1, c)) {
+                out[1].push_back({grid.index(y, c), grid.index(y + 1, c + 1)});
+            }
+            if (isOpen(grid, y, c + 1) && isOpen(grid, y + 1, c) && !isOpen(grid, y, c) && !isOpen(grid, y + 1, c + 1)) {
+                out[1].push_back({grid.index(y, c + 1), grid.index(y + 1, c)});
+            }
+        }
+    }
+
+    if (!isDiagonal || cr + 1 >= state.clusterRows) return;
+
+    // Corners: a diagonal move into the cluster below-right or below-left.
+    int y = cluster.row0 + cluster.rows - 1;
+    int right = cluster.col0 + cluster.cols - 1;
+    if (cc + 1 < state.clusterCols && isOpen(grid, y, right) && isOpen(grid, y + 1, right + 1) &&
+        !isOpen(grid, y, right + 1) && !isOpen(grid, y + 1, right)) {
+        out[2].push_back({grid.index(y, right), grid.index(y + 1, right + 1)});
+    }
+    int left = cluster.col0;
+    if (cc > 0 && isOpen(grid, y, left) && isOpen(grid, y + 1, left - 1) &&
+        !isOpen(grid, y, left - 1) && !isOpen(grid, y + 1, left)) {
+        out[3].push_back({grid.index(y, left), grid.index(y + 1, left - 1)});
+    }
+}
+
+// Records one side of a transition: 'cell' becomes a node of its cluster (if it is
+// not one already) with a crossing towards 'partner'.
+static void addCrossing(const GridModel& grid, HPAState& state, HPACluster& cluster, int cell, int partner) {
+    if (state.slot[cell] < 0) {
+        state.slot[cell] = static_cast<int>(cluster.nodes.size());
+        cluster.nodes.push_back(cell);
+        cluster.crossings.push_back(0);
+    }
+    int dr = grid.rowOf(partner) - grid.rowOf(cell);
+    int dc = grid.colOf(partner) - grid.colOf(cell);
+    for (int d = 0; d < 8; ++d) {
+        if (DR[d] == dr && DC[d] == dc) cluster.crossings[state.slot[cell]] |= 1 << d;
+    }
+}
+
+/**
+ * @brief Rebuilds a cluster's nodes from the borders around it, and the cached
+ * distances between them (one Dijkstra inside the cluster per node).
+ */
+static void rebuildCluster(const GridModel& grid, HPAState& state, int k, bool isDiagonal) {
+    HPACluster& cluster = state.clusters[k];
+    for (int cell : cluster.nodes) state.slot[cell] = -1;
+    cluster.nodes.clear();
+    cluster.crossings.clear();
+
+    int cr = k / state.clusterCols;
+    int cc = k % state.clusterCols;
+    for (int b = 0; b < 4; ++b) {
+        for (const HPATransition& t : state.borders[k * 4 + b]) addCrossing(grid, state, cluster, t.from, t.to);
+    }
+    // Borders owned by the neighbours on the left, above, above-left and above-right.
+    struct { int dr, dc, border; } owners[] = {{0, -1, 0}, {-1, 0, 1}, {-1, -1, 2}, {-1, 1, 3}};
+    for (const auto& owner : owners) {
+        int nr = cr + owner.dr;
+        int nc = cc + owner.dc;
+        if (nr < 0 || nc < 0 || nc >= state.clusterCols) continue;
+        for (const HPATransition& t : state.borders[(nr * state.clusterCols + nc) * 4 + owner.border]) {
+            addCrossing(grid, state, cluster, t.to, t.from);
+        }
+    }
+
+    std::size_t count = cluster.nodes.size();
+    cluster.dist.assign(count * count, INF);
+    for (std::size_t i = 0; i < count; ++i) {
+        localSearch(grid, state, cluster, cluster.nodes[i], -1, false, isDiagonal, nullptr);
+        for (std::size_t j = 0; j < count; ++j) {
+            cluster.dist[i * count + j] = state.localDist[localIndex(grid, cluster, cluster.nodes[j])];
+        }
+    }
+}
+
+int buildClusters(const GridModel& grid, HPAState& state, bool isDiagonal) {
+    int clusterCount = 0;
+
+    bool full = state.builtCells != grid.size() || state.builtDiagonal != isDiagonal ||
+                state.editsApplied < grid.editsBase;
+    if (full) {
+        state.clusterRows = (grid.rows + state.clusterSize - 1) / state.clusterSize;
+        state.clusterCols = (grid.cols + state.clusterSize - 1) / state.clusterSize;
+        clusterCount = state.clusterRows * state.clusterCols;
+        state.clusters.assign(clusterCount, HPACluster());
+        for (int k = 0; k < clusterCount; ++k) {
+            HPACluster& cluster = state.clusters[k];
+            cluster.row0 = (k / state.clusterCols) * state.clusterSize;
+            cluster.col0 = (k % state.clusterCols) * state.clusterSize;
+            cluster.rows = std::min(state.clusterSize, grid.rows - cluster.row0);
+            cluster.cols = std::min(state.clusterSize, grid.cols - cluster.col0);
+        }
+        state.borders.assign(clusterCount * 4, std::vector<HPATransition>());
+        state.slot.assign(grid.size(), -1);
+        state.dirty.assign(clusterCount, 3);
+    } else {
+        clusterCount = static_cast<int>(state.clusters.size());
+        // An edited cell changes its own cluster, and may add or remove transitions
+        // on any border it lies next to, so the borders around it are rescanned.
+        for (std::size_t i = state.editsApplied - grid.editsBase; i < grid.edits.size(); ++i) {
+            int k = clusterOf(grid, state, grid.edits[i]);
+            state.dirty[k] |= 1;
+            int cr = k / state.clusterCols;
+            int cc = k % state.clusterCols;
+            for (int nr = std::max(0, cr - 1); nr <= std::min(state.clusterRows - 1, cr + 1); ++nr) {
+                for (int nc = std::max(0, cc - 1); nc <= std::min(state.clusterCols - 1, cc + 1); ++nc) {
+                    state.dirty[nr * state.clusterCols + nc] |= 2;
+                }
+            }
+        }
+    }
+    state.editsApplied = grid.editCount();
+    state.builtCells = grid.size();
+    state.builtDiagonal = isDiagonal;
+
+    // Rescan borders; when one changes, both clusters on it need rebuilding.
+    std::vector<HPATransition> scanned[4];
+    int neighborOffset[] = {1, state.clusterCols, state.clusterCols + 1, state.clusterCols - 1};
+    for (int k = 0; k < clusterCount; ++k) {
+        if (!(state.dirty[k] & 2)) continue;
+        scanBorders(grid, state, k, isDiagonal, scanned);
+        for (int b = 0; b < 4; ++b) {
+            if (scanned[b] == state.borders[k * 4 + b]) continue;
+            state.borders[k * 4 + b].swap(scanned[b]);
+            state.dirty[k] |= 1;
+            state.dirty[k + neighborOffset[b]] |= 1;
+        }
+    }
+
+    int rebuilt = 0;
+    for (int k = 0; k < clusterCount; ++k) {
+        if (state.dirty[k] & 1) {
+            rebuildCluster(grid, state, k, isDiagonal);
+            rebuilt++;
+        }
+        state.dirty[k] = 0;
+    }
+    return rebuilt;
+}
+
+// Paints the finished path (or the part refined so far) and reports the result.
+static void finishSearch(GridModel& grid, HPAState& state) {
+    state.isSearching = false;
+    state.isComplete = true;
+    state.currentLine = 17; // return PathFound
+    for (std::size_t i = 1; i < state.path.size(); ++i) {
+        bool diagonal = grid.rowOf(state.path[i]) != grid.rowOf(state.path[i - 1]) &&
+                        grid.colOf(state.path[i]) != grid.colOf(state.path[i - 1]);
+        state.pathCost += grid.costs[state.path[i]] * (diagonal ? state.move.diagonal : state.move.straight);
+    }
+    if (state.drawLivePath) setLivePath(grid, state.livePath, state.path);
+}
+
+// Relaxes an abstract edge during the abstract search.
+static void relax(GridModel& grid, HPAState& state, int from, int to, int cost) {
+    if (cost >= INF || state.marks.closed(to)) return;
+    int g = state.gCost[from] + cost;
+    state.currentLine = 8; // if g[u] + cost < g[v]
+    if (state.marks.seen(to) && g >= state.gCost[to]) return;
+    state.currentLine = 9; // parent[v] = u, open.add(v)
+    state.marks.open(to);
+    state.parent[to] = from;
+    state.gCost[to] = g;
+    state.openSet.push_back({to, g + heuristic(grid, to, grid.endIndex, state.move)});
+    std::push_heap(state.openSet.begin(), state.openSet.end(), std::greater<HPANode>());
+    NodeType type = grid.types[to];
+    if (type != NodeType::Start && type != NodeType::End && type != NodeType::Path) {
+        grid.setType(to, NodeType::Open);
+    }
+}
+
+// Turns the next edge of the abstract path into cells.
+static void refineStep(GridModel& grid, HPAState& state, bool isDiagonal) {
+    state.currentLine = 12; // for each abstract edge (a, b) on the path
+    if (state.refineIndex + 1 >= state.abstractPath.size()) {
+        finishSearch(grid, state);
+        return;
+    }
+
+    int from = state.abstractPath[state.refineIndex];
+    int to = state.abstractPath[state.refineIndex + 1];
+    state.refineIndex++;
+
+    state.currentLine = 13; // if a and b share a cluster
+    int k = clusterOf(grid, state, from);
+    if (k == clusterOf(grid, state, to)) {
+        state.currentLine = 14; // path += A*(a, b) inside the cluster
+        const HPACluster& cluster = state.clusters[k];
+        int expanded = localSearch(grid, state, cluster, from, to, false, isDiagonal, &grid);
+        state.concreteExpanded += expanded;
+        state.nodesVisited += expanded;
+
+        std::size_t first = state.path.size();
+        for (int cell = to; cell != from; cell = state.localParent[localIndex(grid, cluster, cell)]) {
+            state.path.push_back(cell);
+        }
+        std::reverse(state.path.begin() + first, state.path.end());
+    } else {
+        state.currentLine = 16; // path += b
+        state.path.push_back(to);
+    }
+
+    if (state.drawLivePath) setLivePath(grid, state.livePath, state.path);
+}
+
+void hpaStep(GridModel& grid, HPAState& state, bool isDiagonal) {
+    if (!state.isSearching || state.isComplete) return;
+    if (state.isRefining) {
+        refineStep(grid, state, isDiagonal);
+        return;
+    }
+
+    state.currentLine = 4; // while open is not empty
+    if (state.openSet.empty()) {
+        state.noPathExists = true;
+        state.isSearching = false;
+        state.isComplete = true;
+        state.currentLine = 11; // return PathNotFound
+        return;
+    }
+
+    // 1. Take the abstract node with the lowest F-cost.
+    state.currentLine = 5; // u = node in open with lowest fCost
+    std::pop_heap(state.openSet.begin(), state.openSet.end(), std::greater<HPANode>());
+    int current = state.openSet.back().node;
+    state.openSet.pop_back();
+    if (state.marks.closed(current)) return; // A stale entry for a node already expanded.
+    state.marks.close(current);
+    state.abstractExpanded++;
+    state.nodesVisited++;
+
+    NodeType type = grid.types[current];
+    if (type != NodeType::Start && type != NodeType::End && type != NodeType::Path) {
+        grid.setType(current, NodeType::Visited);
+    }
+
+    // 2. Once the end is reached, switch to refining the abstract path.
+    state.currentLine = 6; // if u == goal: break
+    if (current == grid.endIndex) {
+        for (int cell = current; cell != -1; cell = state.parent[cell]) state.abstractPath.push_back(cell);
+        std::reverse(state.abstractPath.begin(), state.abstractPath.end());
+        state.path.push_back(grid.startIndex);
+        state.isRefining = true;
+        return;
+    }
+
+    // 3. Relax the abstract edges: the start's links into its cluster, the cached
+    //    distances to the other nodes of the cluster, the transitions out of it, and
+    //    the link to the end when this is the end's cluster.
+    state.currentLine = 7; // for each abstract edge (u, v, cost)
+    if (current == grid.startIndex) {
+        for (const auto& link : state.startLinks) relax(grid, state, current, link.first, link.second);
+    }
+    int slot = state.slot[current];
+    if (slot >= 0) {
+        int k = clusterOf(grid, state, current);
+        const HPACluster& cluster = state.clusters[k];
+        std::size_t count = cluster.nodes.size();
+        for (std::size_t j = 0; j < count; ++j) {
+            if (static_cast<int>(j) != slot) relax(grid, state, current, cluster.nodes[j], cluster.dist[slot * count + j]);
+        }
+        int r = grid.rowOf(current);
+        int c = grid.colOf(current);
+        for (int d = 0; d < 8; ++d) {
+            if (cluster.crossings[slot] & (1 << d)) {
+                int neighbor = grid.index(r + DR[d], c + DC[d]);
+                relax(grid, state, current, neighbor, grid.costs[neighbor] * (d < 4 ? state.move.straight : state.move.diagonal));
+            }
+        }
+        if (k == clusterOf(grid, state, grid.endIndex)) {
+            relax(grid, state, current, grid.endIndex, state.goalLinks[slot]);
+        }
+    }
+}
+
+void startHPA(GridModel& grid, HPAState& state, bool isDiagonal) {
+    resetHPA(state);
+    state.move = moveCosts(isDiagonal);
+    state.currentLine = 1; // rebuild clusters whose cells changed
+    state.clustersRebuilt = buildClusters(grid, state, isDiagonal);
+
+    // Link the end: the cost from every node of its cluster to it, inside the cluster.
+    state.currentLine = 2; // link start and goal to their cluster's entrances
+    int start = grid.startIndex;
+    int goal = grid.endIndex;
+    const HPACluster& goalCluster = state.clusters[clusterOf(grid, state, goal)];
+    localSearch(grid, state, goalCluster, goal, -1, true, isDiagonal, nullptr);
+    for (int cell : goalCluster.nodes) state.goalLinks.push_back(state.localDist[localIndex(grid, goalCluster, cell)]);
+
+    // Link the start: the cost from it to every node of its cluster (and to the end,
+    // when both share a cluster).
+    const HPACluster& startCluster = state.clusters[clusterOf(grid, state, start)];
+    localSearch(grid, state, startCluster, start, -1, false, isDiagonal, nullptr);
+    for (int cell : startCluster.nodes) {
+        int cost = state.localDist[localIndex(grid, startCluster, cell)];
+        if (cost < INF && cell != start) state.startLinks.push_back({cell, cost});
+    }
+    if (&startCluster == &goalCluster && state.localDist[localIndex(grid, startCluster, goal)] < INF) {
+        state.startLinks.push_back({goal, state.localDist[localIndex(grid, startCluster, goal)]});
+    }
+
+    state.currentLine = 3; // open.add(start)
+    state.marks.begin(grid.size());
+    if (static_cast<int>(state.parent.size()) != grid.size()) {
+        state.parent.resize(grid.size());
+        state.gCost.resize(grid.size());
+    }
+    state.marks.open(start);
+    state.parent[start] = -1;
+    state.gCost[start] = 0;
+    state.openSet.push_back({start, heuristic(grid, start, goal, state.move)});
+    state.isSearching = true;
+}
+
+void resetHPA(HPAState& state) {
+    state.isSearching = false;
+    state.isComplete = false;
+    state.noPathExists = false;
+    state.isRefining = false;
+    resetLivePath(state.livePath);
+    state.openSet.clear();
+    state.startLinks.clear();
+    state.goalLinks.clear();
+    state.abstractPath.clear();
+    state.path.clear();
+    state.refineIndex = 0;
+    state.currentLine = 0;
+    state.abstractExpanded = 0;
+    state.concreteExpanded = 0;
+    state.nodesVisited = 0;
+    state.pathCost = 0;
+}
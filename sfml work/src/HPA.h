@@ -0,0 +1,156 @@
+// ===================================================================================
+// == FILE: src/HPA.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Header file for Hierarchical Pathfinding A* (HPA*). The grid is cut
+// into square clusters; the cells where a path can cross from one cluster into the
+// next become the nodes of a small abstract graph, with the distances between the
+// nodes of each cluster cached. A search runs A* on that graph and then refines
+// only the chosen abstract path into cells, one cluster at a time. The clusters are
+// rebuilt lazily, only where the grid's wall/weight edit journal says cells changed.
+//
+// ===================================================================================
+#ifndef HPA_H
+#define HPA_H
+
+#include "GridModel.h"
+#include "Heuristics.h"
+#include "LivePath.h"
+#include "SearchMarks.h"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief A node wrapper for the HPA* priority queues (a cell and its F-cost).
+ */
+struct HPANode {
+    int node;
+    int fCost;
+
+    // Overload the > operator so std::greater turns the heap into a min-heap.
+    bool operator>(const HPANode& other) const {
+        return fCost > other.fCost;
+    }
+};
+
+/**
+ * @brief One move that crosses from a cluster into a neighbouring one.
+ * 'from' lies in the cluster that owns the border, 'to' in its neighbour.
+ */
+struct HPATransition {
+    int from;
+    int to;
+
+    bool operator==(const HPATransition& other) const {
+        return from == other.from && to == other.to;
+    }
+};
+
+/**
+ * @brief A rectangular block of cells and its part of the abstract graph.
+ */
+struct HPACluster {
+    int row0 = 0, col0 = 0;   // Top-left cell.
+    int rows = 0, cols = 0;   // Size (clusters on the right and bottom edge may be smaller).
+    std::vector<int> nodes;   // The cluster's abstract nodes: cells with a transition.
+    std::vector<std::uint8_t> crossings; // crossings[i]: bit d set if nodes[i] has a transition in direction d.
+    std::vector<int> dist;    // dist[i * nodes.size() + j]: cheapest path nodes[i] -> nodes[j] inside the cluster.
+};
+
+/**
+ * @brief Holds the cluster hierarchy and the state of an HPA* search in progress.
+ */
+struct HPAState {
+    // --- The Abstract Graph (kept between searches) ---
+    int clusterSize = 10;
+    int clusterRows = 0, clusterCols = 0;
+    std::vector<HPACluster> clusters;
+    // borders[k * 4 + b]: transitions from cluster k into its right (b = 0), lower (1),
+    // lower-right (2) and lower-left (3) neighbour.
+    std::vector<std::vector<HPATransition>> borders;
+    std::vector<int> slot;          // slot[cell]: the cell's index in its cluster's node list, or -1.
+    std::vector<std::uint8_t> dirty; // Per cluster: bit 1 = rebuild nodes and distances, bit 2 = rescan borders.
+    std::uint64_t editsApplied = 0; // How far the grid's edit journal has been replayed.
+    int builtCells = 0;             // Grid size the hierarchy was built for (0 = never built).
+    bool builtDiagonal = false;     // Connectivity the hierarchy was built for.
+    int clustersRebuilt = 0;        // Clusters rebuilt by the latest search.
+
+    // --- Abstract Search ---
+    MoveCosts move = moveCosts(false); // Step costs, the same as A*'s (set by startHPA).
+    std::vector<HPANode> openSet;   // Binary min-heap on F-cost.
+    SearchMarks marks;              // Open/closed markers for abstract nodes.
+    std::vector<int> parent;        // parent[cell]: the abstract node it was reached from.
+    std::vector<int> gCost;         // gCost[cell]: cheapest known cost from the start.
+    std::vector<std::pair<int, int>> startLinks; // Cells reachable from the start inside its cluster, with costs.
+    std::vector<int> goalLinks;     // Per node of the end's cluster: cost to the end inside the cluster.
+
+    // --- Refinement ---
+    std::vector<int> abstractPath;  // Start, the abstract nodes on the path, end.
+    std::size_t refineIndex = 0;    // The next abstract edge to turn into cells.
+    std::vector<int> path;          // The concrete path refined so far.
+    bool isRefining = false;
+
+    // Scratch space for searches inside a single cluster, indexed by cell within the cluster.
+    std::vector<int> localDist;
+    std::vector<int> localParent;
+    std::vector<std::uint8_t> localClosed;
+    std::vector<HPANode> localHeap;
+
+    // --- State Flags ---
+    bool isSearching = false;  // True while the algorithm is actively running.
+    bool isComplete = false;   // True when the algorithm has finished (found a path or not).
+    bool noPathExists = false; // True if the abstract search runs out of nodes.
+
+    // --- Visualization & Stats ---
+    int currentLine = 0;       // The current line of pseudocode to highlight.
+    int abstractExpanded = 0;  // Abstract nodes taken off the open set.
+    int concreteExpanded = 0;  // Cells expanded while refining the abstract path.
+    int nodesVisited = 0;      // Both of the above.
+    int pathCost = 0;          // The total cost of the final path found, in move.straight units per step.
+    bool drawLivePath = true;  // Headless runs turn this off to skip the per-step path redraw.
+    LivePath livePath;         // The yellow path painted by the previous step.
+};
+
+/**
+ * @brief Performs a single step of HPA*: expands one abstract node, or refines one
+ * edge of the abstract path once it has been found.
+ * @param grid The pathfinding grid model (passed by reference).
+ * @param state The current state of the search (passed by reference).
+ * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
+ */
+void hpaStep(GridModel& grid, HPAState& state, bool isDiagonal);
+
+/**
+ * @brief Brings the cluster hierarchy up to date with the grid.
+ *
+ * Builds everything the first time (or when the grid size or connectivity changes);
+ * afterwards only the clusters whose cells or borders were edited are rebuilt.
+ * @param grid The pathfinding grid model.
+ * @param state The state that owns the hierarchy.
+ * @param isDiagonal Whether the hierarchy is for 8-directional movement.
+ * @return The number of clusters that were rebuilt.
+ */
+int buildClusters(const GridModel& grid, HPAState& state, bool isDiagonal);
+
+/**
+ * @brief Resets the search, updates the hierarchy and links the start and end into it.
+ *
+ * Like LPA*, HPA* needs the connectivity up front, as the hierarchy depends on it.
+ * @param grid The pathfinding grid model; its startIndex and endIndex must be set.
+ * @param state The HPA* state object to initialize (passed by reference).
+ * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
+ */
+void startHPA(GridModel& grid, HPAState& state, bool isDiagonal);
+
+/**
+ * @brief Resets the HPA* search to its default values. The cluster hierarchy is
+ * kept, since it only depends on the map.
+ * @param state The HPA* state object to reset (passed by reference).
+ */
+void resetHPA(HPAState& state);
+
+#endif // HPA_H
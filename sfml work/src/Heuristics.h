@@ -0,0 +1,97 @@
+// ===================================================================================
+// == FILE: src/Heuristics.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: The movement model and distance heuristics shared by A* and Dijkstra.
+// With diagonals enabled, costs are kept in fixed point (hundredths) so a diagonal
+// step costs 141, close to 100 * sqrt(2), while everything stays an integer; without
+// them a step simply costs 1. The heuristics estimate the remaining cost in the same
+// units, and all but Manhattan (on diagonal grids) never overestimate it.
+//
+// ===================================================================================
+#ifndef HEURISTICS_H
+#define HEURISTICS_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+/**
+ * @brief The distance estimates A* can use. Auto picks the one that matches the
+ * movement model: Manhattan on 4-connected grids, octile on 8-connected ones.
+ * Landmarks is the ALT bound from precomputed tables (see Landmarks.h), taken
+ * together with the octile estimate.
+ */
+enum class HeuristicKind { Auto, Manhattan, Octile, Chebyshev, Euclidean, Landmarks };
+
+/**
+ * @brief The cost of one straight and one diagonal step into a cell of cost 1.
+ * A move into a cell costs the cell's cost times one of these.
+ */
+struct MoveCosts {
+    int straight;
+    int diagonal;
+    bool cutCorners = true; // False: a diagonal may not squeeze past a wall beside it.
+};
+
+/**
+ * @brief The movement model for a connectivity. On 4-connected grids a "diagonal"
+ * is two straight steps, which makes the octile distance equal to Manhattan. The
+ * Moving AI benchmarks forbid cutting corners; the visualizer allows it.
+ */
+inline MoveCosts moveCosts(bool isDiagonal, bool cutCorners = true) {
+    return isDiagonal ? MoveCosts{100, 141, cutCorners} : MoveCosts{1, 2, cutCorners};
+}
+
+inline HeuristicKind resolveHeuristic(HeuristicKind kind, bool isDiagonal) {
+    if (kind != HeuristicKind::Auto) return kind;
+    return isDiagonal ? HeuristicKind::Octile : HeuristicKind::Manhattan;
+}
+
+inline const char* heuristicName(HeuristicKind kind) {
+    switch (kind) {
+        case HeuristicKind::Auto: return "Auto";
+        case HeuristicKind::Manhattan: return "Manhattan";
+        case HeuristicKind::Octile: return "Octile";
+        case HeuristicKind::Chebyshev: return "Chebyshev";
+        case HeuristicKind::Euclidean: return "Euclidean";
+        case HeuristicKind::Landmarks: return "ALT";
+    }
+    return "";
+}
+
+/**
+ * @brief Estimates the cost of moving dr rows and dc columns over cells of cost 1.
+ *
+ * Octile is the exact cost on an open 8-connected grid: diagonal steps until one
+ * axis is done, then straight ones. Chebyshev charges every step as a straight one.
+ * Euclidean is scaled so a run of diagonals is not overestimated (141 is a little
+ * under 100 * sqrt(2)); it is then never more than octile, and stays consistent.
+ * Manhattan overestimates once diagonals are allowed. Landmarks needs tables this
+ * function does not have, so it returns the octile part of its estimate.
+ */
+inline int heuristicCost(HeuristicKind kind, int dr, int dc, MoveCosts move) {
+    dr = std::abs(dr);
+    dc = std::abs(dc);
+    int lo = std::min(dr, dc);
+    int hi = std::max(dr, dc);
+    switch (kind) {
+        case HeuristicKind::Auto:
+        case HeuristicKind::Octile:
+        case HeuristicKind::Landmarks:
+            return move.straight * hi + (move.diagonal - move.straight) * lo;
+        case HeuristicKind::Manhattan:
+            return move.straight * (dr + dc);
+        case HeuristicKind::Chebyshev:
+            return move.straight * hi;
+        case HeuristicKind::Euclidean: {
+            double perUnit = std::min<double>(move.straight, move.diagonal / std::sqrt(2.0));
+            return static_cast<int>(perUnit * std::sqrt(static_cast<double>(dr) * dr + static_cast<double>(dc) * dc));
+        }
+    }
+    return 0;
+}
+
+#endif // HEURISTICS_H
@@ -0,0 +1,519 @@
+// ===================================================================================
+// == FILE: src/JPS.cpp ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Implements the step-by-step logic for Jump Point Search and JPS+.
+// The pruning and jump rules follow the usual grid formulation: with diagonals on,
+// a diagonal move may squeeze between two walls (as in every other algorithm
+// here); with diagonals off, vertical jumps also stop where a horizontal jump
+// would find something.
+//
+// ===================================================================================
+#include "JPS.h"
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+
+// Direction deltas in the order every algorithm uses: up, down, left, right, then
+// the diagonals (up-left, up-right, down-left, down-right).
+static const int DR[] = {-1, 1, 0, 0, -1, -1, 1, 1};
+static const int DC[] = {0, 0, -1, 1, -1, 1, -1, 1};
+
+// Packed layout used to scan in each straight direction (up, down, left, right).
+enum { PackEast, PackWest, PackSouth, PackNorth };
+static const int PACK_FOR_DIR[] = {PackNorth, PackSouth, PackWest, PackEast};
+
+static int sign(int v) { return (v > 0) - (v < 0); }
+
+static int directionIndex(int dr, int dc) {
+    for (int d = 0; d < 8; ++d) {
+        if (DR[d] == dr && DC[d] == dc) return d;
+    }
+    return -1;
+}
+
+static bool walkable(const GridModel& grid, int r, int c) {
+    return grid.isValid(r, c) && grid.types[grid.index(r, c)] != NodeType::Wall;
+}
+
+// The octile distance in the run's step costs (Manhattan without diagonals), as A* uses.
+static int heuristic(const GridModel& grid, int a, int b, MoveCosts move) {
+    return heuristicCost(HeuristicKind::Octile, grid.rowOf(a) - grid.rowOf(b), grid.colOf(a) - grid.colOf(b), move);
+}
+
+// The cost between two jump points, which always share a straight or diagonal line.
+static int segmentCost(const GridModel& grid, int a, int b, MoveCosts move) {
+    int dr = std::abs(grid.rowOf(a) - grid.rowOf(b));
+    int dc = std::abs(grid.colOf(a) - grid.colOf(b));
+    return std::max(dr, dc) * (dr != 0 && dc != 0 ? move.diagonal : move.straight);
+}
+
+// --- Forced Neighbour Rules ---
+
+// True if a straight move in (dr, dc) that arrives at (r, c) has a forced neighbour there.
+static bool forcedStraight(const GridModel& grid, int r, int c, int dr, int dc, bool isDiagonal) {
+    if (dr == 0) {
+        if (isDiagonal) {
+            return (walkable(grid, r + 1, c + dc) && !walkable(grid, r + 1, c)) ||
+                   (walkable(grid, r - 1, c + dc) && !walkable(grid, r - 1, c));
+        }
+        return (walkable(grid, r - 1, c) && !walkable(grid, r - 1, c - dc)) ||
+               (walkable(grid, r + 1, c) && !walkable(grid, r + 1, c - dc));
+    }
+    if (isDiagonal) {
+        return (walkable(grid, r + dr, c + 1) && !walkable(grid, r, c + 1)) ||
+               (walkable(grid, r + dr, c - 1) && !walkable(grid, r, c - 1));
+    }
+    return (walkable(grid, r, c - 1) && !walkable(grid, r - dr, c - 1)) ||
+           (walkable(grid, r, c + 1) && !walkable(grid, r - dr, c + 1));
+}
+
+// True if a diagonal move in (dr, dc) that arrives at (r, c) has a forced neighbour there.
+static bool forcedDiagonal(const GridModel& grid, int r, int c, int dr, int dc) {
+    return (walkable(grid, r + dr, c - dc) && !walkable(grid, r, c - dc)) ||
+           (walkable(grid, r - dr, c + dc) && !walkable(grid, r - dr, c));
+}
+
+/**
+ * @brief Lists the directions worth exploring from 'node' after arriving from 'from'.
+ *
+ * These are the "natural" neighbours (straight on, plus both components of a
+ * diagonal) and any "forced" ones next to a wall. From the start every direction
+ * is explored.
+ * @return The number of directions written to 'dirs'.
+ */
+static int prunedDirections(const GridModel& grid, int node, int from, bool isDiagonal, int* dirs) {
+    int count = 0;
+    if (from == -1) {
+        int numDirections = isDiagonal ? 8 : 4;
+        for (int d = 0; d < numDirections; ++d) dirs[count++] = d;
+        return count;
+    }
+
+    int r = grid.rowOf(node);
+    int c = grid.colOf(node);
+    int dr = sign(r - grid.rowOf(from));
+    int dc = sign(c - grid.colOf(from));
+
+    if (!isDiagonal) {
+        if (dc != 0) {
+            dirs[count++] = directionIndex(-1, 0);
+            dirs[count++] = directionIndex(1, 0);
+            dirs[count++] = directionIndex(0, dc);
+        } else {
+            dirs[count++] = directionIndex(0, -1);
+            dirs[count++] = directionIndex(0, 1);
+            dirs[count++] = directionIndex(dr, 0);
+        }
+        return count;
+    }
+
+    if (dr != 0 && dc != 0) {
+        dirs[count++] = directionIndex(dr, 0);
+        dirs[count++] = directionIndex(0, dc);
+        dirs[count++] = directionIndex(dr, dc);
+        if (!walkable(grid, r, c - dc)) dirs[count++] = directionIndex(dr, -dc);
+        if (!walkable(grid, r - dr, c)) dirs[count++] = directionIndex(-dr, dc);
+    } else if (dc == 0) {
+        dirs[count++] = directionIndex(dr, 0);
+        if (!walkable(grid, r, c + 1)) dirs[count++] = directionIndex(dr, 1);
+        if (!walkable(grid, r, c - 1)) dirs[count++] = directionIndex(dr, -1);
+    } else {
+        dirs[count++] = directionIndex(0, dc);
+        if (!walkable(grid, r + 1, c)) dirs[count++] = directionIndex(1, dc);
+        if (!walkable(grid, r - 1, c)) dirs[count++] = directionIndex(-1, dc);
+    }
+    return count;
+}
+
+// --- Bit-Packed Wall Layouts (JPS) ---
+
+// Maps a cell to its (line, position) in one of the packed layouts, and back.
+static void toLine(const GridModel& grid, int layout, int r, int c, int& line, int& pos) {
+    switch (layout) {
+        case PackEast:  line = r; pos = c; break;
+        case PackWest:  line = r; pos = grid.cols - 1 - c; break;
+        case PackSouth: line = c; pos = r; break;
+        default:        line = c; pos = grid.rows - 1 - r; break;
+    }
+}
+
+static int fromLine(const GridModel& grid, int layout, int line, int pos) {
+    switch (layout) {
+        case PackEast:  return grid.index(line, pos);
+        case PackWest:  return grid.index(line, grid.cols - 1 - pos);
+        case PackSouth: return grid.index(pos, line);
+        default:        return grid.index(grid.rows - 1 - pos, line);
+    }
+}
+
+void packWalls(const GridModel& grid, JPSState& state) {
+    if (state.packedVersion == grid.wallVersion && state.packedCells == grid.size()) return;
+
+    for (int layout = 0; layout < 4; ++layout) {
+        PackedWalls& packed = state.packed[layout];
+        bool byRow = (layout == PackEast || layout == PackWest);
+        packed.lines = byRow ? grid.rows : grid.cols;
+        packed.length = byRow ? grid.cols : grid.rows;
+        packed.wordsPerLine = (packed.length + 63) / 64;
+        packed.bits.assign(packed.lines * packed.wordsPerLine, 0);
+
+        // Everything past the end of a line reads as a wall, so scans stop there.
+        if (packed.length % 64 != 0) {
+            for (int line = 0; line < packed.lines; ++line) {
+                packed.bits[line * packed.wordsPerLine + packed.wordsPerLine - 1] |= ~0ULL << (packed.length % 64);
+            }
+        }
+    }
+
+    for (int i = 0; i < grid.size(); ++i) {
+        if (grid.types[i] != NodeType::Wall) continue;
+        for (int layout = 0; layout < 4; ++layout) {
+            PackedWalls& packed = state.packed[layout];
+            int line, pos;
+            toLine(grid, layout, grid.rowOf(i), grid.colOf(i), line, pos);
+            packed.bits[line * packed.wordsPerLine + (pos >> 6)] |= 1ULL << (pos & 63);
+        }
+    }
+
+    state.packedVersion = grid.wallVersion;
+    state.packedCells = grid.size();
+}
+
+// The 64 wall bits of a line starting at 'pos' (lines outside the grid are all wall).
+static std::uint64_t wallWindow(const PackedWalls& packed, int line, int pos) {
+    if (line < 0 || line >= packed.lines) return ~0ULL;
+    const std::uint64_t* words = &packed.bits[line * packed.wordsPerLine];
+    int word = pos >> 6;
+    int offset = pos & 63;
+    std::uint64_t low = word < packed.wordsPerLine ? words[word] : ~0ULL;
+    if (offset == 0) return low;
+    std::uint64_t high = word + 1 < packed.wordsPerLine ? words[word + 1] : ~0ULL;
+    return (low >> offset) | (high << (64 - offset));
+}
+
+static inline int lowestBit(std::uint64_t bits) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(bits);
+#else
+    int bit = 0;
+    while (!(bits & 1)) {
+        bits >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+/**
+ * @brief Scans a packed line from 'pos' towards higher positions, 64 cells at a time.
+ *
+ * A cell is a jump point if it is the goal or has a forced neighbour on one of the
+ * two side lines. With diagonals on, that is a side wall that ends one cell
+ * further on; without them, a side wall that ended one cell back.
+ * @param lastFree Receives the last free position the scan covered.
+ * @return The position of the first jump point, or -1 if a wall comes first.
+ */
+static int scanLine(const PackedWalls& packed, int line, int pos, int goalPos, bool isDiagonal, int& lastFree) {
+    for (;; pos += 64) {
+        std::uint64_t walls = wallWindow(packed, line, pos);
+        std::uint64_t above = wallWindow(packed, line - 1, pos);
+        std::uint64_t below = wallWindow(packed, line + 1, pos);
+        std::uint64_t forced;
+        if (isDiagonal) {
+            forced = (above & ~wallWindow(packed, line - 1, pos + 1)) | (below & ~wallWindow(packed, line + 1, pos + 1));
+        } else {
+            forced = (~above & wallWindow(packed, line - 1, pos - 1)) | (~below & wallWindow(packed, line + 1, pos - 1));
+        }
+        if (goalPos >= pos && goalPos - pos < 64) forced |= 1ULL << (goalPos - pos);
+
+        // Only jump points in front of the first wall count.
+        int firstWall = walls ? lowestBit(walls) : 64;
+        std::uint64_t beforeWall = firstWall == 64 ? ~0ULL : (1ULL << firstWall) - 1;
+        if (forced & beforeWall) {
+            lastFree = pos + lowestBit(forced & beforeWall);
+            return lastFree;
+        }
+        if (walls) {
+            lastFree = pos + firstWall - 1;
+            return -1;
+        }
+    }
+}
+
+// Paints a cell a jump scanned over, so the visualizer shows how far JPS looked.
+static void markScanned(GridModel& grid, const JPSState& state, int cell) {
+    if (state.paintScans && grid.types[cell] == NodeType::Empty) grid.setType(cell, NodeType::Visited);
+}
+
+// Jumps from 'node' in straight direction 'dir' using the packed walls.
+static int jumpStraight(GridModel& grid, const JPSState& state, int node, int dir, bool isDiagonal) {
+    int layout = PACK_FOR_DIR[dir];
+    int line, pos, goalLine, goalPos;
+    toLine(grid, layout, grid.rowOf(node), grid.colOf(node), line, pos);
+    toLine(grid, layout, grid.rowOf(grid.endIndex), grid.colOf(grid.endIndex), goalLine, goalPos);
+    if (goalLine != line) goalPos = -1;
+
+    int lastFree;
+    int hit = scanLine(state.packed[layout], line, pos + 1, goalPos, isDiagonal, lastFree);
+    if (state.paintScans) {
+        for (int p = pos + 1; p <= lastFree; ++p) markScanned(grid, state, fromLine(grid, layout, line, p));
+    }
+    return hit < 0 ? -1 : fromLine(grid, layout, line, hit);
+}
+
+/**
+ * @brief Jumps from 'node' in direction 'dir' until a jump point or a wall.
+ * @return The jump point's cell, or -1 if the jump ran into a wall.
+ */
+static int jump(GridModel& grid, const JPSState& state, int node, int dir, bool isDiagonal) {
+    int dr = DR[dir];
+    int dc = DC[dir];
+    if (dir < 4 && (isDiagonal || dr == 0)) return jumpStraight(grid, state, node, dir, isDiagonal);
+
+    // Vertical jumps without diagonals, and diagonal jumps, also stop wherever a
+    // straight jump sideways finds a jump point, so they step one cell at a time.
+    int r = grid.rowOf(node);
+    int c = grid.colOf(node);
+    int vertical = directionIndex(dr, 0);
+    while (true) {
+        r += dr;
+        c += dc;
+        if (!walkable(grid, r, c)) return -1;
+        int cell = grid.index(r, c);
+        markScanned(grid, state, cell);
+        if (cell == grid.endIndex) return cell;
+
+        if (dc == 0) {
+            if (forcedStraight(grid, r, c, dr, 0, false)) return cell;
+            if (jumpStraight(grid, state, cell, directionIndex(0, -1), false) != -1 ||
+                jumpStraight(grid, state, cell, directionIndex(0, 1), false) != -1) {
+                return cell;
+            }
+        } else {
+            if (forcedDiagonal(grid, r, c, dr, dc)) return cell;
+            if (jumpStraight(grid, state, cell, directionIndex(0, dc), true) != -1 ||
+                jumpStraight(grid, state, cell, vertical, true) != -1) {
+                return cell;
+            }
+        }
+    }
+}
+
+// --- Jump Distance Table (JPS+) ---
+
+// True if a move in direction 'dir' that arrives at (r, c) has to stop there.
+static bool isJumpPoint(const GridModel& grid, const JPSState& state, int r, int c, int dir, bool isDiagonal) {
+    int dr = DR[dir];
+    int dc = DC[dir];
+    const std::int16_t* here = &state.jumpDistances[grid.index(r, c) * 8];
+    if (dir < 4) {
+        if (forcedStraight(grid, r, c, dr, dc, isDiagonal)) return true;
+        // Without diagonals, vertical jumps also stop where a horizontal jump succeeds.
+        return !isDiagonal && dc == 0 && (here[directionIndex(0, -1)] > 0 || here[directionIndex(0, 1)] > 0);
+    }
+    return forcedDiagonal(grid, r, c, dr, dc) || here[directionIndex(0, dc)] > 0 || here[directionIndex(dr, 0)] > 0;
+}
+
+void buildJumpDistances(const GridModel& grid, JPSState& state, bool isDiagonal) {
+    if (state.tableVersion == grid.wallVersion && state.tableCells == grid.size() &&
+        state.tableDiagonal == isDiagonal) {
+        return;
+    }
+    state.jumpDistances.assign(grid.size() * 8, 0);
+
+    // Horizontal directions first, as vertical ones (without diagonals) and diagonal
+    // ones read them. Each direction sweeps the grid starting from the far side, so
+    // the entry of the next cell along is always ready.
+    const int order[] = {2, 3, 0, 1, 4, 5, 6, 7};
+    int numDirections = isDiagonal ? 8 : 4;
+    for (int k = 0; k < numDirections; ++k) {
+        int dir = order[k];
+        int dr = DR[dir];
+        int dc = DC[dir];
+        for (int i = 0; i < grid.rows; ++i) {
+            int r = dr > 0 ? grid.rows - 1 - i : i;
+            for (int j = 0; j < grid.cols; ++j) {
+                int c = dc > 0 ? grid.cols - 1 - j : j;
+                int nr = r + dr;
+                int nc = c + dc;
+                int distance = 0; // A wall right next to the cell.
+                if (walkable(grid, nr, nc)) {
+                    if (isJumpPoint(grid, state, nr, nc, dir, isDiagonal)) {
+                        distance = 1;
+                    } else {
+                        int next = state.jumpDistances[grid.index(nr, nc) * 8 + dir];
+                        distance = next > 0 ? next + 1 : next - 1;
+                    }
+                }
+                state.jumpDistances[grid.index(r, c) * 8 + dir] = static_cast<std::int16_t>(distance);
+            }
+        }
+    }
+
+    state.tableVersion = grid.wallVersion;
+    state.tableCells = grid.size();
+    state.tableDiagonal = isDiagonal;
+}
+
+/**
+ * @brief Finds the JPS+ successor of 'node' in direction 'dir' from the table.
+ *
+ * The table does not know where the goal is, so it is checked here: if the goal
+ * lies on the line within reach it is the successor, and a diagonal (or, without
+ * diagonals, a vertical) move stops at the cell level with the goal, from where a
+ * straight move can reach it.
+ * @return The successor's cell, or -1 if there is none.
+ */
+static int jumpFromTable(const GridModel& grid, const JPSState& state, int node, int dir, bool isDiagonal) {
+    int distance = state.jumpDistances[node * 8 + dir];
+    int reach = std::abs(distance);
+    int dr = DR[dir];
+    int dc = DC[dir];
+    int r = grid.rowOf(node);
+    int c = grid.colOf(node);
+    int gr = grid.rowOf(grid.endIndex) - r;
+    int gc = grid.colOf(grid.endIndex) - c;
+
+    if (dir < 4) {
+        bool goalOnLine = (dr == 0) ? (gr == 0 && sign(gc) == dc && std::abs(gc) <= reach)
+                                    : (gc == 0 && sign(gr) == dr && std::abs(gr) <= reach);
+        if (goalOnLine) return grid.endIndex;
+        if (!isDiagonal && dr != 0 && sign(gr) == dr && std::abs(gr) <= reach) return grid.index(r + gr, c);
+    } else if (sign(gr) == dr && sign(gc) == dc) {
+        int level = std::min(std::abs(gr), std::abs(gc));
+        if (level <= reach) return grid.index(r + level * dr, c + level * dc);
+    }
+    return distance > 0 ? grid.index(r + distance * dr, c + distance * dc) : -1;
+}
+
+// --- Shared Search Loop ---
+
+// Rebuilds the live path from the start to 'tip', filling in the cells between jump points.
+static void traceChain(const GridModel& grid, JPSState& state, int tip) {
+    state.chain.clear();
+    for (int node = tip; node != -1; node = state.parent[node]) {
+        state.chain.push_back(node);
+        int from = state.parent[node];
+        if (from == -1) break;
+        int stepToFrom = sign(grid.rowOf(from) - grid.rowOf(node)) * grid.cols + sign(grid.colOf(from) - grid.colOf(node));
+        for (int cell = node + stepToFrom; cell != from; cell += stepToFrom) state.chain.push_back(cell);
+    }
+    std::reverse(state.chain.begin(), state.chain.end());
+}
+
+/**
+ * @brief One expansion shared by JPS and JPS+; they only differ in how a jump is made.
+ *
+ * The pseudocode listings differ, so the highlighted line numbers are picked per variant.
+ */
+static void jumpSearchStep(GridModel& grid, JPSState& state, bool isDiagonal, bool useTable) {
+    if (!state.isSearching || state.isComplete) return;
+
+    if (useTable) {
+        state.currentLine = 1; // jumpDist = precompute(walls)
+        buildJumpDistances(grid, state, isDiagonal);
+    } else {
+        packWalls(grid, state);
+    }
+
+    state.currentLine = useTable ? 3 : 2; // while openSet is not empty
+    if (state.openSet.empty()) {
+        state.noPathExists = true;
+        state.isSearching = false;
+        state.isComplete = true;
+        state.currentLine = 17; // return PathNotFound
+        return;
+    }
+
+    // 1. Get the jump point with the lowest F-cost, skipping stale heap entries.
+    state.currentLine = useTable ? 4 : 3; // current = node in openSet with lowest fCost
+    std::pop_heap(state.openSet.begin(), state.openSet.end(), std::greater<JPSNode>());
+    int current = state.openSet.back().node;
+    state.openSet.pop_back();
+    if (state.marks.closed(current)) return;
+    state.marks.close(current);
+    state.nodesVisited++;
+
+    if (state.drawLivePath) {
+        traceChain(grid, state, current);
+        setLivePath(grid, state.livePath, state.chain);
+    }
+
+    if (current == grid.endIndex) {
+        state.pathCost = state.gCost[current];
+        state.isComplete = true;
+        state.isSearching = false;
+        state.currentLine = 5; // return PathFound
+        return;
+    }
+
+    if (grid.types[current] != NodeType::Start && grid.types[current] != NodeType::Path) {
+        grid.setType(current, NodeType::Visited);
+    }
+
+    // 2. Jump in every direction that survives pruning.
+    int dirs[8];
+    int numDirs = prunedDirections(grid, current, state.parent[current], isDiagonal, dirs);
+    for (int i = 0; i < numDirs; ++i) {
+        state.currentLine = useTable ? 7 : 8; // d = jumpDist[...] / jumpPoint = jump(...)
+        int next = useTable ? jumpFromTable(grid, state, current, dirs[i], isDiagonal)
+                            : jump(grid, state, current, dirs[i], isDiagonal);
+        if (next == -1 || state.marks.closed(next)) continue;
+
+        // 3. Relax the jump point exactly like an A* neighbour.
+        state.currentLine = useTable ? 13 : 10; // if ... g < gCost[...]
+        int g = state.gCost[current] + segmentCost(grid, current, next, state.move);
+        int oldG = state.marks.seen(next) ? state.gCost[next] : std::numeric_limits<int>::max();
+        if (g < oldG) {
+            state.marks.open(next);
+            state.parent[next] = current;
+            state.gCost[next] = g;
+            state.openSet.push_back({next, g + heuristic(grid, next, grid.endIndex, state.move)});
+            std::push_heap(state.openSet.begin(), state.openSet.end(), std::greater<JPSNode>());
+            state.currentLine = useTable ? 14 : 13; // openSet.add(...)
+
+            NodeType nextType = grid.types[next];
+            if (nextType != NodeType::Start && nextType != NodeType::End && nextType != NodeType::Path) {
+                grid.setType(next, NodeType::Open);
+            }
+        }
+    }
+}
+
+void jpsStep(GridModel& grid, JPSState& state, bool isDiagonal) {
+    jumpSearchStep(grid, state, isDiagonal, false);
+}
+
+void jpsPlusStep(GridModel& grid, JPSState& state, bool isDiagonal) {
+    jumpSearchStep(grid, state, isDiagonal, true);
+}
+
+void startJPS(GridModel& grid, JPSState& state, bool isDiagonal) {
+    resetJPS(state);
+    state.move = moveCosts(isDiagonal);
+    state.marks.begin(grid.size());
+    if (static_cast<int>(state.parent.size()) != grid.size()) {
+        state.parent.resize(grid.size());
+        state.gCost.resize(grid.size());
+    }
+    state.marks.open(grid.startIndex);
+    state.parent[grid.startIndex] = -1;
+    state.gCost[grid.startIndex] = 0;
+    state.openSet.push_back({grid.startIndex, 0});
+    state.isSearching = true;
+}
+
+void resetJPS(JPSState& state) {
+    state.isSearching = false;
+    state.isComplete = false;
+    state.noPathExists = false;
+    resetLivePath(state.livePath);
+    state.openSet.clear();
+    state.currentLine = 0;
+    state.nodesVisited = 0;
+    state.pathCost = 0;
+}
@@ -0,0 +1,153 @@
+// ===================================================================================
+// == FILE: src/JPS.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Header file for Jump Point Search (JPS) and its precomputed variant,
+// JPS+. Both are A* searches for uniform-cost grids that skip over the long runs
+// of symmetric cells A* would expand one by one, only stopping at "jump points".
+// JPS finds them with scans over bit-packed rows of the wall layout; JPS+ looks
+// them up in a table of jump distances built once per wall layout.
+//
+// ===================================================================================
+#ifndef JPS_H
+#define JPS_H
+
+#include "GridModel.h"
+#include "Heuristics.h"
+#include "LivePath.h"
+#include "SearchMarks.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief A node wrapper for the JPS priority queue (a jump point and its F-cost).
+ */
+struct JPSNode {
+    int node;
+    int fCost;
+
+    // Overload the > operator so std::greater turns the heap into a min-heap.
+    bool operator>(const JPSNode& other) const {
+        return fCost > other.fCost;
+    }
+};
+
+/**
+ * @brief The wall layout packed 64 cells to a word, once per straight scan direction.
+ *
+ * Each copy stores the grid as "lines" scanned towards increasing positions: rows
+ * for east, mirrored rows for west, columns for south and mirrored columns for
+ * north. A set bit is a wall (cells past the end of a line read as walls too), so a
+ * straight jump tests 64 cells and both of their side lines with a few word ops.
+ */
+struct PackedWalls {
+    int lines = 0;        // Number of lines (rows or columns).
+    int length = 0;       // Cells per line.
+    int wordsPerLine = 0; // 64-bit words per line.
+    std::vector<std::uint64_t> bits;
+};
+
+/**
+ * @brief Holds all state information for a JPS or JPS+ search in progress.
+ */
+struct JPSState {
+    // The "open set" of jump points, kept as a binary min-heap on F-cost.
+    std::vector<JPSNode> openSet;
+
+    // Open/closed markers for this run (see SearchMarks).
+    SearchMarks marks;
+
+    // parent[i] is the jump point that jump point i was reached from. Consecutive
+    // jump points lie on one straight or diagonal line, never further apart.
+    std::vector<int> parent;
+
+    // gCost[i] is the cost from the start to jump point i.
+    std::vector<int> gCost;
+    MoveCosts move = moveCosts(false); // Step costs, the same as A*'s (set by startJPS).
+
+    // --- Precomputed Wall Data (rebuilt only when the grid's wallVersion changes) ---
+    PackedWalls packed[4];          // JPS: east, west, south and north scan layouts.
+    std::uint64_t packedVersion = UINT64_MAX;
+    int packedCells = 0;
+
+    // JPS+: jumpDistances[cell * 8 + dir] is the number of moves to the next jump
+    // point in that direction, or minus the number of free cells before a wall.
+    std::vector<std::int16_t> jumpDistances;
+    std::uint64_t tableVersion = UINT64_MAX;
+    int tableCells = 0;
+    bool tableDiagonal = false;
+
+    // --- State Flags ---
+    bool isSearching = false;  // True while the algorithm is actively running.
+    bool isComplete = false;   // True when the algorithm has finished (found a path or not).
+    bool noPathExists = false; // True if the open set becomes empty before the end is found.
+
+    // --- Visualization & Stats ---
+    int currentLine = 0;      // The current line of pseudocode to highlight.
+    int nodesVisited = 0;     // Jump points taken off the open set.
+    int pathCost = 0;         // The total cost of the final path found, in move.straight units per step.
+    bool drawLivePath = true; // Headless runs turn this off to skip the per-step path redraw.
+    bool paintScans = true;   // Paint the cells each JPS jump scans over as visited.
+    LivePath livePath;        // The yellow path painted by the previous step.
+    std::vector<int> chain;   // Scratch buffer for the cells of the live path.
+};
+
+/**
+ * @brief Performs a single step of Jump Point Search: expands one jump point.
+ *
+ * Walls are the only obstacles; weighted cells are treated as ordinary cells, as
+ * JPS only applies to uniform-cost grids.
+ * @param grid The pathfinding grid model (passed by reference).
+ * @param state The current state of the search (passed by reference).
+ * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
+ */
+void jpsStep(GridModel& grid, JPSState& state, bool isDiagonal);
+
+/**
+ * @brief Performs a single step of JPS+: expands one jump point using the
+ * precomputed jump distances instead of scanning the grid.
+ *
+ * The jump distance table is (re)built on the first step after the walls change.
+ * @param grid The pathfinding grid model (passed by reference).
+ * @param state The current state of the search (passed by reference).
+ * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
+ */
+void jpsPlusStep(GridModel& grid, JPSState& state, bool isDiagonal);
+
+/**
+ * @brief Packs the wall layout into the bit rows JPS scans.
+ *
+ * Does nothing if the packed rows already match the grid's walls.
+ * @param grid The pathfinding grid model.
+ * @param state The state that owns the packed rows.
+ */
+void packWalls(const GridModel& grid, JPSState& state);
+
+/**
+ * @brief Builds the JPS+ jump distance table for the grid's current wall layout.
+ *
+ * Does nothing if the table already matches the layout and connectivity.
+ * @param grid The pathfinding grid model.
+ * @param state The state that owns the table.
+ * @param isDiagonal Whether the table is for 8-directional movement.
+ */
+void buildJumpDistances(const GridModel& grid, JPSState& state, bool isDiagonal);
+
+/**
+ * @brief Resets the JPS state and seeds the open set with the grid's start cell.
+ * @param grid The pathfinding grid model; its startIndex and endIndex must be set.
+ * @param state The JPS state object to initialize (passed by reference).
+ * @param isDiagonal Whether diagonal moves are allowed; it picks the step costs.
+ */
+void startJPS(GridModel& grid, JPSState& state, bool isDiagonal);
+
+/**
+ * @brief Resets the JPS state to its default values for a new search. Precomputed
+ * wall data is kept, since it only depends on the walls.
+ * @param state The JPS state object to reset (passed by reference).
+ */
+void resetJPS(JPSState& state);
+
+#endif // JPS_H
@@ -0,0 +1,319 @@
+// ===================================================================================
+// == FILE: src/LPAStar.cpp ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Implements the step-by-step logic for Lifelong Planning A*, the
+// replay of wall/weight edits into a finished search, and the statistics that
+// compare a repair with a search from scratch.
+//
+// ===================================================================================
+#include "LPAStar.h"
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <functional>
+
+static const int INF = INT_MAX / 2; // Large enough for any path, small enough to add a cost to.
+
+// Direction deltas in the order every algorithm uses: up, down, left, right, then diagonals.
+static const int DR[] = {-1, 1, 0, 0, -1, -1, 1, 1};
+static const int DC[] = {0, 0, -1, 1, -1, 1, -1, 1};
+
+// The octile distance in the run's step costs (Manhattan without diagonals). Every
+// cell costs at least 1, so it is consistent, which LPA* needs for its keys.
+static int heuristic(const GridModel& grid, int a, int b, MoveCosts move) {
+    return heuristicCost(HeuristicKind::Octile, grid.rowOf(a) - grid.rowOf(b), grid.colOf(a) - grid.colOf(b), move);
+}
+
+static int gOf(const LPAState& state, int cell) { return state.marks.seen(cell) ? state.g[cell] : INF; }
+static int rhsOf(const LPAState& state, int cell) { return state.marks.seen(cell) ? state.rhs[cell] : INF; }
+
+// Gives a cell its "infinite" values the first time this search writes to it.
+static void reach(LPAState& state, int cell) {
+    if (state.marks.seen(cell)) return;
+    state.marks.open(cell);
+    state.g[cell] = INF;
+    state.rhs[cell] = INF;
+    state.parent[cell] = -1;
+}
+
+// Counts a cell the first time the current run changes one of its values.
+static void touch(LPAState& state, int cell) {
+    if (state.touched.seen(cell)) return;
+    state.touched.open(cell);
+    state.nodesTouched++;
+}
+
+static LPANode keyOf(const GridModel& grid, const LPAState& state, int cell) {
+    int m = std::min(gOf(state, cell), rhsOf(state, cell));
+    return {cell, m + heuristic(grid, cell, state.goalCell, state.move), m};
+}
+
+/**
+ * @brief Recomputes a cell's rhs from its neighbours and queues it if that leaves
+ * it inconsistent (g != rhs).
+ *
+ * Entering a cell costs that cell's cost times the step (straight or diagonal), so
+ * rhs is the smallest g plus that cost among its non-wall neighbours. A wall can neither be entered nor left,
+ * so it is pinned to infinity straight away.
+ */
+static void updateVertex(const GridModel& grid, LPAState& state, int cell, bool isDiagonal, GridModel* canvas) {
+    if (grid.types[cell] == NodeType::Wall) {
+        if (state.marks.seen(cell) && (state.g[cell] != INF || state.rhs[cell] != INF)) {
+            state.g[cell] = INF;
+            state.rhs[cell] = INF;
+            state.parent[cell] = -1;
+            touch(state, cell);
+        }
+        return;
+    }
+
+    int best = INF;
+    int bestParent = -1;
+    if (cell == state.startCell) {
+        best = 0;
+    } else {
+        int r = grid.rowOf(cell);
+        int c = grid.colOf(cell);
+        int numDirections = isDiagonal ? 8 : 4;
+        for (int i = 0; i < numDirections; ++i) {
+            int new_r = r + DR[i];
+            int new_c = c + DC[i];
+            if (!grid.isValid(new_r, new_c)) continue;
+            int neighbor = grid.index(new_r, new_c);
+            if (grid.types[neighbor] == NodeType::Wall) continue;
+            int g = gOf(state, neighbor);
+            int cost = grid.costs[cell] * (i < 4 ? state.move.straight : state.move.diagonal);
+            if (g < INF && g + cost < best) {
+                best = g + cost;
+                bestParent = neighbor;
+            }
+        }
+    }
+
+    if (best != rhsOf(state, cell)) {
+        reach(state, cell);
+        state.rhs[cell] = best;
+        touch(state, cell);
+    }
+    if (state.marks.seen(cell)) state.parent[cell] = bestParent;
+
+    if (gOf(state, cell) != rhsOf(state, cell)) {
+        state.openSet.push_back(keyOf(grid, state, cell));
+        std::push_heap(state.openSet.begin(), state.openSet.end(), std::greater<LPANode>());
+        NodeType type = grid.types[cell];
+        if (canvas && type != NodeType::Start && type != NodeType::End && type != NodeType::Path) {
+            canvas->setType(cell, NodeType::Open);
+        }
+    }
+}
+
+// Updates every non-wall neighbour of a cell (its successors, and its predecessors:
+// on a grid they are the same cells).
+static void updateNeighbors(const GridModel& grid, LPAState& state, int cell, bool isDiagonal, GridModel* canvas) {
+    int r = grid.rowOf(cell);
+    int c = grid.colOf(cell);
+    int numDirections = isDiagonal ? 8 : 4;
+    for (int i = 0; i < numDirections; ++i) {
+        int new_r = r + DR[i];
+        int new_c = c + DC[i];
+        if (grid.isValid(new_r, new_c)) updateVertex(grid, state, grid.index(new_r, new_c), isDiagonal, canvas);
+    }
+}
+
+// Follows the rhs parents from a cell back towards the start. Until the search has
+// settled, parents can still form a loop, so the walk is capped at the grid size.
+static void traceChain(const GridModel& grid, LPAState& state, int from) {
+    state.chain.clear();
+    for (int cell = from; cell != -1 && static_cast<int>(state.chain.size()) < grid.size();
+         cell = state.marks.seen(cell) ? state.parent[cell] : -1) {
+        state.chain.push_back(cell);
+    }
+    std::reverse(state.chain.begin(), state.chain.end());
+}
+
+/**
+ * @brief One LPA* step: drops stale queue entries, then expands one inconsistent
+ * cell or finishes the run.
+ * @param canvas The grid to paint queued and expanded cells and the live path on, or
+ * nullptr to search without drawing.
+ */
+static void expandNext(const GridModel& grid, LPAState& state, bool isDiagonal, GridModel* canvas) {
+    if (!state.isSearching || state.isComplete) return;
+
+    // 1. Drop queue entries that are out of date: their cell has become consistent,
+    //    or its key changed and a newer entry was pushed for it.
+    while (!state.openSet.empty()) {
+        const LPANode& top = state.openSet.front();
+        LPANode key = keyOf(grid, state, top.node);
+        if (gOf(state, top.node) != rhsOf(state, top.node) && key.k1 == top.k1 && key.k2 == top.k2) break;
+        std::pop_heap(state.openSet.begin(), state.openSet.end(), std::greater<LPANode>());
+        state.openSet.pop_back();
+    }
+
+    // 2. Stop once nothing left in the queue can improve the end's value.
+    state.currentLine = 3; // while topKey < key(goal) or rhs[goal] != g[goal]
+    int goal = state.goalCell;
+    bool goalSettled = gOf(state, goal) == rhsOf(state, goal);
+    if (state.openSet.empty() || (goalSettled && !(keyOf(grid, state, goal) > state.openSet.front()))) {
+        state.isSearching = false;
+        state.isComplete = true;
+        state.currentLine = 12; // return PathFound / PathNotFound
+        if (gOf(state, goal) >= INF) {
+            state.noPathExists = true;
+            return;
+        }
+        traceChain(grid, state, goal);
+        if (canvas && state.drawLivePath) setLivePath(*canvas, state.livePath, state.chain);
+        state.pathCost = state.g[goal];
+        return;
+    }
+
+    // 3. Expand the inconsistent cell with the smallest key.
+    state.currentLine = 4; // u = queue.pop()
+    std::pop_heap(state.openSet.begin(), state.openSet.end(), std::greater<LPANode>());
+    int current = state.openSet.back().node;
+    state.openSet.pop_back();
+    state.nodesVisited++;
+
+    NodeType type = grid.types[current];
+    if (canvas && type != NodeType::Start && type != NodeType::End && type != NodeType::Path) {
+        canvas->setType(current, NodeType::Visited);
+    }
+
+    state.currentLine = 5; // if g[u] > rhs[u]
+    if (state.g[current] > state.rhs[current]) {
+        // Overconsistent: the cell got cheaper, so settle it and pass that on.
+        state.currentLine = 6; // g[u] = rhs[u]
+        state.g[current] = state.rhs[current];
+        touch(state, current);
+        state.currentLine = 7; // for each successor s: updateVertex(s)
+        updateNeighbors(grid, state, current, isDiagonal, canvas);
+    } else {
+        // Underconsistent: the cell got dearer (an edit cut its old path), so forget
+        // its value; the cell and everything built on it are recomputed.
+        state.currentLine = 9; // g[u] = infinity
+        state.g[current] = INF;
+        touch(state, current);
+        state.currentLine = 10; // updateVertex(u) and each successor s
+        updateVertex(grid, state, current, isDiagonal, canvas);
+        updateNeighbors(grid, state, current, isDiagonal, canvas);
+    }
+
+    if (canvas && state.drawLivePath) {
+        traceChain(grid, state, current);
+        setLivePath(*canvas, state.livePath, state.chain);
+    }
+}
+
+void lpaStep(GridModel& grid, LPAState& state, bool isDiagonal) {
+    expandNext(grid, state, isDiagonal, &grid);
+}
+
+bool lpaApplyEdits(GridModel& grid, LPAState& state, bool isDiagonal) {
+    if (!state.isSearching && !state.isComplete) return false;
+    if (grid.editCount() == state.editsApplied) return false;
+    if (grid.startIndex < 0 || grid.endIndex < 0) {
+        resetLPA(state);
+        return false;
+    }
+
+    // Anything but plain wall/weight edits invalidates the whole tree.
+    if (grid.startIndex != state.startCell || grid.endIndex != state.goalCell || isDiagonal != state.isDiagonal ||
+        state.editsApplied < grid.editsBase || static_cast<int>(state.g.size()) != grid.size()) {
+        startLPA(grid, state, isDiagonal);
+        return true;
+    }
+
+    resetLivePath(state.livePath);
+    state.touched.begin(grid.size());
+    state.nodesTouched = 0;
+    state.nodesVisited = 0;
+    state.pathCost = 0;
+    state.isRepair = true;
+    state.isSearching = true;
+    state.isComplete = false;
+    state.noPathExists = false;
+
+    // An edited cell changes the cost of entering it and, for walls, of leaving it,
+    // so the cell and all of its neighbours need their rhs recomputed.
+    state.currentLine = 15; // updateVertex(c) and each neighbor of c
+    for (std::size_t i = state.editsApplied - grid.editsBase; i < grid.edits.size(); ++i) {
+        int cell = grid.edits[i];
+        updateVertex(grid, state, cell, isDiagonal, &grid);
+        updateNeighbors(grid, state, cell, isDiagonal, &grid);
+    }
+    state.editsApplied = grid.editCount();
+    return true;
+}
+
+/**
+ * @brief Starts LPA* from scratch.
+ *
+ * As with the other searches only a new marker generation is started, so g and
+ * rhs do not have to be filled with infinity first.
+ */
+static void seedSearch(const GridModel& grid, LPAState& state, bool isDiagonal) {
+    resetLPA(state);
+    state.marks.begin(grid.size());
+    state.touched.begin(grid.size());
+    if (static_cast<int>(state.g.size()) != grid.size()) {
+        state.g.resize(grid.size());
+        state.rhs.resize(grid.size());
+        state.parent.resize(grid.size());
+    }
+    state.startCell = grid.startIndex;
+    state.goalCell = grid.endIndex;
+    state.isDiagonal = isDiagonal;
+    state.move = moveCosts(isDiagonal);
+    state.editsApplied = grid.editCount();
+
+    state.currentLine = 1; // rhs[start] = 0, queue.add(start)
+    reach(state, state.startCell);
+    state.rhs[state.startCell] = 0;
+    touch(state, state.startCell);
+    state.openSet.push_back(keyOf(grid, state, state.startCell));
+    state.isSearching = true;
+}
+
+void startLPA(GridModel& grid, LPAState& state, bool isDiagonal) {
+    seedSearch(grid, state, isDiagonal);
+}
+
+void resetLPA(LPAState& state) {
+    state.isSearching = false;
+    state.isComplete = false;
+    state.noPathExists = false;
+    state.isRepair = false;
+    resetLivePath(state.livePath);
+    state.openSet.clear(); // Keeps the capacity for the next run.
+    state.startCell = -1;
+    state.goalCell = -1;
+    state.editsApplied = 0;
+    state.currentLine = 0;
+    state.nodesVisited = 0;
+    state.nodesTouched = 0;
+    state.pathCost = 0;
+}
+
+int lpaFullReplanTouched(const GridModel& grid, bool isDiagonal, LPAComparison& comparison) {
+    if (comparison.nodesTouched >= 0 && comparison.version == grid.contentVersion() &&
+        comparison.start == grid.startIndex && comparison.end == grid.endIndex &&
+        comparison.isDiagonal == isDiagonal) {
+        return comparison.nodesTouched;
+    }
+
+    LPAState& state = comparison.scratch;
+    state.drawLivePath = false;
+    seedSearch(grid, state, isDiagonal);
+    while (!state.isComplete) expandNext(grid, state, isDiagonal, nullptr);
+
+    comparison.version = grid.contentVersion();
+    comparison.start = grid.startIndex;
+    comparison.end = grid.endIndex;
+    comparison.isDiagonal = isDiagonal;
+    comparison.nodesTouched = state.nodesTouched;
+    return comparison.nodesTouched;
+}
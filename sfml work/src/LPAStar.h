@@ -0,0 +1,144 @@
+// ===================================================================================
+// == FILE: src/LPAStar.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Header file for Lifelong Planning A* (LPA*), the incremental search
+// D* Lite is built on. It keeps its g-values between runs, so when walls or
+// weights are edited after (or during) a search it only repairs the part of the
+// shortest-path tree the edits affect instead of searching from scratch.
+//
+// ===================================================================================
+#ifndef LPASTAR_H
+#define LPASTAR_H
+
+#include "GridModel.h"
+#include "Heuristics.h"
+#include "LivePath.h"
+#include "SearchMarks.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief A node wrapper for the LPA* priority queue.
+ *
+ * LPA* orders nodes by the key [min(g, rhs) + h, min(g, rhs)], compared
+ * lexicographically. The overloaded '>' operator turns std::greater into a min-heap.
+ */
+struct LPANode {
+    int node;
+    int k1;
+    int k2;
+
+    bool operator>(const LPANode& other) const {
+        return k1 != other.k1 ? k1 > other.k1 : k2 > other.k2;
+    }
+};
+
+/**
+ * @brief Holds all state information for an LPA* search, kept alive between edits.
+ */
+struct LPAState {
+    // The priority queue of inconsistent cells (g != rhs). Entries are never removed
+    // early; one whose key no longer matches its cell is skipped when popped.
+    std::vector<LPANode> openSet;
+
+    // Cells that have a g or rhs value in this search. Unseen cells read as infinity,
+    // so starting a search does not have to fill the arrays below.
+    SearchMarks marks;
+    std::vector<int> g;      // g[i]: the cost of the best path to i found so far.
+    std::vector<int> rhs;    // rhs[i]: one-step lookahead, min over neighbours p of g[p] + cost(p, i).
+    std::vector<int> parent; // parent[i]: the neighbour that gave rhs[i] its value.
+
+    // Cells whose g or rhs changed during the current run (the first search, or the
+    // repair after the latest edits).
+    SearchMarks touched;
+    int nodesTouched = 0;
+
+    // What the search was built for. A different start, end or connectivity, or edits
+    // that fell out of the grid's journal, force a search from scratch.
+    int startCell = -1;
+    int goalCell = -1;
+    bool isDiagonal = false;
+    MoveCosts move = moveCosts(false); // Step costs, the same as A*'s.
+    std::uint64_t editsApplied = 0; // How far the grid's edit journal has been replayed.
+
+    // --- State Flags ---
+    bool isSearching = false;  // True while the algorithm is actively running.
+    bool isComplete = false;   // True when the current run has finished (found a path or not).
+    bool noPathExists = false; // True if the end cannot be reached.
+    bool isRepair = false;     // True when the current run repairs an earlier search.
+
+    // --- Visualization & Stats ---
+    int currentLine = 0;      // The current line of pseudocode to highlight.
+    int nodesVisited = 0;     // Cells expanded by the current run.
+    int pathCost = 0;         // The total cost of the final path found, in move.straight units per step.
+    bool drawLivePath = true; // Headless runs turn this off to skip the per-step path redraw.
+    LivePath livePath;        // The yellow path painted by the previous step.
+    std::vector<int> chain;   // Scratch buffer for the cells of the live path.
+};
+
+/**
+ * @brief Performs a single step of LPA*: expands one inconsistent cell.
+ * @param grid The pathfinding grid model (passed by reference).
+ * @param state The current state of the search (passed by reference).
+ * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
+ */
+void lpaStep(GridModel& grid, LPAState& state, bool isDiagonal);
+
+/**
+ * @brief Replays the grid's new wall and weight edits into a search that has
+ * already started, turning it back into a running search that repairs its tree.
+ *
+ * Searches from scratch instead when the start, end or connectivity changed.
+ * @param grid The pathfinding grid model; its search markers should be cleared first.
+ * @param state The LPA* state to update (passed by reference).
+ * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
+ * @return True if there were edits to apply.
+ */
+bool lpaApplyEdits(GridModel& grid, LPAState& state, bool isDiagonal);
+
+/**
+ * @brief Starts a search from scratch, seeding the queue with the start cell.
+ *
+ * Unlike the other searches, LPA* needs the connectivity up front: its queue keys
+ * include the heuristic, which is Manhattan or octile distance depending on it.
+ * @param grid The pathfinding grid model; its startIndex and endIndex must be set.
+ * @param state The LPA* state object to initialize (passed by reference).
+ * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
+ */
+void startLPA(GridModel& grid, LPAState& state, bool isDiagonal);
+
+/**
+ * @brief Resets the LPA* state to its default values, forgetting the search.
+ * @param state The LPA* state object to reset (passed by reference).
+ */
+void resetLPA(LPAState& state);
+
+/**
+ * @brief An off-screen LPA* search from scratch, run to compare a repair with, and
+ * the query it answered, so the same map is not searched twice.
+ */
+struct LPAComparison {
+    LPAState scratch;             // g, rhs and queue of the hidden search.
+    std::uint64_t version = 0;    // The grid's contentVersion() when it ran.
+    int start = -1, end = -1;
+    bool isDiagonal = false;
+    int nodesTouched = -1;        // -1 until a search has run.
+};
+
+/**
+ * @brief Runs LPA* from scratch without drawing, or returns the count from the
+ * previous run if the map, start, end and connectivity are unchanged.
+ *
+ * The search only reads the grid (painted cells are ignored) and works in the
+ * comparison's scratch state, whose arrays are reused between runs.
+ * @param grid The grid to search.
+ * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
+ * @param comparison The cached result and scratch space (passed by reference).
+ * @return The number of cells the full search touched, to compare a repair with.
+ */
+int lpaFullReplanTouched(const GridModel& grid, bool isDiagonal, LPAComparison& comparison);
+
+#endif // LPASTAR_H
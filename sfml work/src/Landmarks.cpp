@@ -0,0 +1,167 @@
+// ===================================================================================
+// == FILE: src/Landmarks.cpp ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Implements landmark placement, the distance tables and the ALT
+// lower bound used by A*.
+//
+// ===================================================================================
+#include "Landmarks.h"
+#include "Heuristics.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+static const int UNREACHED = std::numeric_limits<int>::max();
+
+/**
+ * @brief Fills tables.dist with the cost of the cheapest path from 'source' to every
+ * cell, or from every cell to 'source' when 'toSource' is set. Entering a cell costs
+ * that cell's cost times the step, so the two directions differ around weights.
+ */
+static void fillDistances(const GridModel& grid, LandmarkTables& tables, int source, bool isDiagonal, bool toSource) {
+    static const int DR[] = {-1, 1, 0, 0, -1, -1, 1, 1};
+    static const int DC[] = {0, 0, -1, 1, -1, 1, -1, 1};
+    MoveCosts move = moveCosts(isDiagonal);
+    int numDirections = isDiagonal ? 8 : 4;
+
+    tables.dist.assign(grid.size(), UNREACHED);
+    tables.queue.reset(QueueKind::Auto, WEIGHT_COST * (isDiagonal ? move.diagonal : move.straight), grid.size());
+    tables.dist[source] = 0;
+    tables.queue.push(source, 0);
+
+    while (!tables.queue.empty()) {
+        int current = tables.queue.pop().node;
+        int r = grid.rowOf(current);
+        int c = grid.colOf(current);
+        for (int i = 0; i < numDirections; ++i) {
+            int nr = r + DR[i];
+            int nc = c + DC[i];
+            if (!grid.isValid(nr, nc)) continue;
+            int neighbor = grid.index(nr, nc);
+            if (grid.types[neighbor] == NodeType::Wall) continue;
+
+            // Walking backwards from the source, the move being priced is the one from
+            // the neighbour into the current cell.
+            int entered = toSource ? current : neighbor;
+            int cost = tables.dist[current] + grid.costs[entered] * (i < 4 ? move.straight : move.diagonal);
+            if (cost < tables.dist[neighbor]) {
+                tables.dist[neighbor] = cost;
+                tables.queue.push(neighbor, cost);
+            }
+        }
+    }
+}
+
+// The reachable cell with the largest value in 'values', or -1 if none is above 0.
+static int farthestCell(const std::vector<int>& values) {
+    int best = -1;
+    for (int i = 0; i < static_cast<int>(values.size()); ++i) {
+        if (values[i] != UNREACHED && values[i] > 0 && (best < 0 || values[i] > values[best])) best = i;
+    }
+    return best;
+}
+
+bool landmarksStale(const GridModel& grid, const LandmarkTables& tables, bool isDiagonal) {
+    return tables.builtCells != grid.size() || tables.builtDiagonal != isDiagonal ||
+           tables.editsBuilt != grid.editCount() || tables.builtCount != std::max(tables.count, 1);
+}
+
+void buildLandmarks(const GridModel& grid, LandmarkTables& tables, bool isDiagonal) {
+    auto began = std::chrono::steady_clock::now();
+    tables.cells.clear();
+    tables.narrow.clear();
+    tables.wide.clear();
+    tables.builtCells = grid.size();
+    tables.builtDiagonal = isDiagonal;
+    tables.editsBuilt = grid.editCount();
+    tables.builtCount = std::max(tables.count, 1);
+
+    // Farthest-point selection starts from the start cell, or any open cell.
+    int seed = grid.startIndex;
+    for (int i = 0; seed < 0 && i < grid.size(); ++i) {
+        if (grid.types[i] != NodeType::Wall) seed = i;
+    }
+
+    int stride = 2 * tables.builtCount;
+    std::uint32_t longest = 0;
+    if (seed >= 0) {
+        // Until the first landmark exists, the seed stands in for it.
+        fillDistances(grid, tables, seed, isDiagonal, false);
+        tables.nearest = tables.dist;
+        tables.wide.assign(static_cast<std::size_t>(grid.size()) * stride, std::numeric_limits<std::uint32_t>::max());
+
+        for (int l = 0; l < tables.builtCount; ++l) {
+            int landmark = farthestCell(tables.nearest);
+            if (landmark < 0) break; // Every reachable cell already is a landmark.
+            tables.cells.push_back(landmark);
+            if (l == 0) std::fill(tables.nearest.begin(), tables.nearest.end(), UNREACHED);
+
+            for (int direction = 0; direction < 2; ++direction) {
+                fillDistances(grid, tables, landmark, isDiagonal, direction == 1);
+                for (int i = 0; i < grid.size(); ++i) {
+                    if (tables.dist[i] == UNREACHED) continue;
+                    tables.wide[static_cast<std::size_t>(i) * stride + 2 * l + direction] = tables.dist[i];
+                    longest = std::max(longest, static_cast<std::uint32_t>(tables.dist[i]));
+                }
+            }
+            // The landmark tables' "from" column is what the next pick maximizes.
+            for (int i = 0; i < grid.size(); ++i) {
+                std::uint32_t from = tables.wide[static_cast<std::size_t>(i) * stride + 2 * l];
+                if (from != std::numeric_limits<std::uint32_t>::max()) {
+                    tables.nearest[i] = std::min(tables.nearest[i], static_cast<int>(from));
+                }
+            }
+        }
+    }
+
+    // Halve the tables when every distance fits below the 16-bit "unreachable" value.
+    tables.isWide = longest >= std::numeric_limits<std::uint16_t>::max();
+    if (!tables.isWide) {
+        tables.narrow.resize(tables.wide.size());
+        for (std::size_t i = 0; i < tables.wide.size(); ++i) {
+            std::uint32_t value = tables.wide[i];
+            tables.narrow[i] = value == std::numeric_limits<std::uint32_t>::max()
+                                   ? std::numeric_limits<std::uint16_t>::max()
+                                   : static_cast<std::uint16_t>(value);
+        }
+        std::vector<std::uint32_t>().swap(tables.wide);
+    }
+    tables.bytes = tables.narrow.size() * sizeof(std::uint16_t) + tables.wide.size() * sizeof(std::uint32_t);
+
+    // The scratch arrays are only needed while building.
+    std::vector<int>().swap(tables.dist);
+    std::vector<int>().swap(tables.nearest);
+    tables.buildSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - began).count();
+}
+
+// The bound for one table width: d(L, goal) - d(L, cell) holds because the path
+// L -> cell -> goal is at least as long as the best path L -> goal, and
+// d(cell, L) - d(goal, L) because cell -> goal -> L is at least d(cell, L).
+template <typename Distance>
+static int bestBound(const std::vector<Distance>& table, int landmarks, int cell, int goal) {
+    const Distance UNKNOWN = std::numeric_limits<Distance>::max();
+    std::size_t stride = 2 * static_cast<std::size_t>(landmarks);
+    const Distance* atCell = &table[cell * stride];
+    const Distance* atGoal = &table[goal * stride];
+    long long best = 0;
+    for (int l = 0; l < landmarks; ++l) {
+        Distance fromCell = atCell[2 * l], fromGoal = atGoal[2 * l];
+        if (fromCell != UNKNOWN && fromGoal != UNKNOWN) {
+            best = std::max(best, static_cast<long long>(fromGoal) - fromCell);
+        }
+        Distance toCell = atCell[2 * l + 1], toGoal = atGoal[2 * l + 1];
+        if (toCell != UNKNOWN && toGoal != UNKNOWN) {
+            best = std::max(best, static_cast<long long>(toCell) - toGoal);
+        }
+    }
+    return static_cast<int>(best);
+}
+
+int landmarkHeuristic(const LandmarkTables& tables, int cell, int goal) {
+    if (tables.cells.empty()) return 0;
+    if (tables.isWide) return bestBound(tables.wide, tables.builtCount, cell, goal);
+    return bestBound(tables.narrow, tables.builtCount, cell, goal);
+}
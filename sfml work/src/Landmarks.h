@@ -0,0 +1,89 @@
+// ===================================================================================
+// == FILE: src/Landmarks.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Header file for the ALT (A*, Landmarks, Triangle inequality)
+// heuristic. A few landmark cells are spread over the map and the exact cost from
+// and to every cell is precomputed for each of them; the triangle inequality then
+// turns those tables into a lower bound on the cost between any two cells, which
+// follows the walls of a maze far better than a straight-line estimate. The tables
+// only depend on the map, so they are kept between searches and rebuilt when the
+// grid's wall/weight edit journal says the map changed.
+//
+// ===================================================================================
+#ifndef LANDMARKS_H
+#define LANDMARKS_H
+
+#include "GridModel.h"
+#include "MonotoneQueue.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The landmark cells and their distance tables.
+ *
+ * The tables are stored cell by cell, so one lookup touches a single small block:
+ * for cell c and landmark l, entry [c * 2K + 2l] is the cost from the landmark to c
+ * and entry [c * 2K + 2l + 1] the cost from c to the landmark (entering a cell costs
+ * that cell's cost, so the two differ on weighted maps). When every distance fits,
+ * entries take 16 bits instead of 32. Unreachable cells hold the largest value.
+ */
+struct LandmarkTables {
+    int count = 4;                     // Landmarks to place on the next build.
+    std::vector<int> cells;            // The landmarks that were placed.
+    std::vector<std::uint16_t> narrow; // Tables when the longest distance fits in 16 bits...
+    std::vector<std::uint32_t> wide;   // ...and when it does not.
+    bool isWide = false;
+
+    // What the tables were built for; a different size, connectivity, landmark count
+    // or newer edits make them stale.
+    int builtCells = 0;                // 0 = never built.
+    bool builtDiagonal = false;
+    std::uint64_t editsBuilt = 0;
+    int builtCount = 0;                // Columns per cell are 2 * builtCount.
+
+    // --- Stats ---
+    double buildSeconds = 0.0;         // Time the latest build took.
+    std::size_t bytes = 0;             // Memory held by the tables.
+
+    // Scratch space for the builds.
+    MonotoneQueue queue;
+    std::vector<int> dist;
+    std::vector<int> nearest;          // nearest[c]: cost from the closest landmark so far.
+};
+
+/**
+ * @brief True if the tables do not describe the grid's current walls and weights.
+ * @param grid The pathfinding grid model.
+ * @param tables The landmark tables to check.
+ * @param isDiagonal Whether the tables are wanted for 8-directional movement.
+ */
+bool landmarksStale(const GridModel& grid, const LandmarkTables& tables, bool isDiagonal);
+
+/**
+ * @brief Places the landmarks and fills their tables.
+ *
+ * Landmarks are chosen by farthest-point selection: the first is the cell farthest
+ * from the start (or from the first open cell), and each next one the cell farthest
+ * from all landmarks placed so far, which spreads them around the edge of the map.
+ * Every landmark then costs two full Dijkstra runs, one from it and one to it.
+ * @param grid The pathfinding grid model.
+ * @param tables The tables to (re)build.
+ * @param isDiagonal Whether the distances are for 8-directional movement.
+ */
+void buildLandmarks(const GridModel& grid, LandmarkTables& tables, bool isDiagonal);
+
+/**
+ * @brief The ALT lower bound on the cost from a cell to the goal: the largest of
+ * d(L, goal) - d(L, cell) and d(cell, L) - d(goal, L) over all landmarks L.
+ * @param tables Up-to-date landmark tables.
+ * @param cell The cell to estimate from.
+ * @param goal The cell to estimate to.
+ * @return The estimate, or 0 if no landmark reaches both cells.
+ */
+int landmarkHeuristic(const LandmarkTables& tables, int cell, int goal);
+
+#endif // LANDMARKS_H
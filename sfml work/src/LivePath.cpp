@@ -0,0 +1,98 @@
+// ===================================================================================
+// == FILE: src/LivePath.cpp ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Implements the incremental live-path redraw used by BFS, DFS, A*
+// and Dijkstra.
+//
+// ===================================================================================
+#include "LivePath.h"
+#include <cstddef>
+
+void updateLivePath(GridModel& grid, LivePath& path, int tip, const std::vector<int>& parent) {
+    // 1. Walk back from the tip until we reach the start or a cell painted last step.
+    //    Painted cells are closed cells, so their parents can no longer change and the
+    //    old chain from the start up to that junction is still correct.
+    path.branch.clear();
+    int tracer = tip;
+    while (tracer != -1 && tracer != grid.startIndex && grid.types[tracer] != NodeType::Path) {
+        path.branch.push_back(tracer);
+        tracer = parent[tracer];
+    }
+
+    // 2. Keep the old cells up to and including the junction. The search for it runs
+    //    from the tip side, so it only touches the cells that are about to be removed.
+    std::size_t keep = 0;
+    if (tracer != -1 && tracer != grid.startIndex) {
+        keep = path.cells.size();
+        while (keep > 0 && path.cells[keep - 1] != tracer) --keep;
+    }
+
+    // 3. Un-paint the old tail back to 'visited'.
+    for (std::size_t i = keep; i < path.cells.size(); ++i) {
+        int cell = path.cells[i];
+        if (grid.types[cell] == NodeType::Path) {
+            grid.setType(cell, NodeType::Visited);
+        }
+    }
+    path.cells.resize(keep);
+
+    // 4. Paint the new branch, start side first. The red end node is never recolored.
+    for (auto it = path.branch.rbegin(); it != path.branch.rend(); ++it) {
+        if (*it == grid.endIndex) continue;
+        grid.setType(*it, NodeType::Path);
+        path.cells.push_back(*it);
+    }
+}
+
+// What a cell covered by setLivePath() turns back into once the path moves on.
+static NodeType uncoveredType(NodeType covered) {
+    switch (covered) {
+        case NodeType::Visited:
+        case NodeType::Open:        return NodeType::Visited;
+        case NodeType::VisitedBack:
+        case NodeType::OpenBack:    return NodeType::VisitedBack;
+        default:                    return covered;
+    }
+}
+
+void setLivePath(GridModel& grid, LivePath& path, const std::vector<int>& chain) {
+    // 1. Collect the paintable part of the chain into the scratch buffer.
+    path.branch.clear();
+    for (int cell : chain) {
+        if (cell != grid.startIndex && cell != grid.endIndex) path.branch.push_back(cell);
+    }
+
+    // 2. Keep the old cells the two chains share from the start side.
+    std::size_t keep = 0;
+    while (keep < path.cells.size() && keep < path.branch.size() && path.cells[keep] == path.branch[keep]) {
+        ++keep;
+    }
+
+    // 3. Un-paint the old tail back to what it covered.
+    for (std::size_t i = keep; i < path.cells.size(); ++i) {
+        int cell = path.cells[i];
+        if (grid.types[cell] == NodeType::Path) {
+            grid.setType(cell, uncoveredType(path.covered[i]));
+        }
+    }
+    path.cells.resize(keep);
+    path.covered.resize(keep);
+
+    // 4. Paint the rest of the new chain (a cell listed twice is only painted once).
+    for (std::size_t i = keep; i < path.branch.size(); ++i) {
+        int cell = path.branch[i];
+        if (grid.types[cell] == NodeType::Path) continue;
+        path.covered.push_back(grid.types[cell]);
+        grid.setType(cell, NodeType::Path);
+        path.cells.push_back(cell);
+    }
+}
+
+void resetLivePath(LivePath& path) {
+    path.cells.clear();
+    path.branch.clear();
+    path.covered.clear();
+}
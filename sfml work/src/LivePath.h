@@ -0,0 +1,66 @@
+// ===================================================================================
+// == FILE: src/LivePath.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Header file for the live-path tracker shared by the pathfinding
+// algorithms. It draws the yellow "current path" from the start to the cell being
+// processed, remembering what it painted so that each step only repaints the part
+// of the path that actually changed.
+//
+// ===================================================================================
+#ifndef LIVEPATH_H
+#define LIVEPATH_H
+
+#include "GridModel.h"
+#include <vector>
+
+/**
+ * @brief Remembers the cells painted as the live path during the previous step.
+ *
+ * 'cells' is ordered from the start side towards the tip. Consecutive steps of a
+ * search usually share most of their parent chain, so only the cells after the
+ * point where the old and new chains meet are un-painted and re-painted.
+ */
+struct LivePath {
+    std::vector<int> cells;  // Painted path cells, start side first (start/end excluded).
+    std::vector<int> branch; // Scratch buffer for the new part of the chain.
+    std::vector<NodeType> covered; // What each cell looked like before setLivePath() painted it.
+};
+
+/**
+ * @brief Moves the live path so that it ends at 'tip'.
+ *
+ * Walks the parent chain back from the tip only until it reaches the start or a
+ * cell that is already painted, then swaps the old tail for the new branch. The
+ * cost is proportional to the number of cells that change, not to the grid size.
+ *
+ * @param grid The pathfinding grid model the path is painted on.
+ * @param path The tracker holding the previously painted cells.
+ * @param tip The cell the algorithm is currently processing.
+ * @param parent The algorithm's parent array (-1 marks a cell without a parent).
+ */
+void updateLivePath(GridModel& grid, LivePath& path, int tip, const std::vector<int>& parent);
+
+/**
+ * @brief Moves the live path onto an explicit chain of cells.
+ *
+ * Used by searches whose parent links skip over cells (such as jump point search),
+ * so the path cannot be followed one parent at a time. Only the cells after the
+ * common prefix of the old and new chains are repainted. Un-painted cells go back
+ * to what they were (a cell the search had reached shows as visited by its side).
+ *
+ * @param grid The pathfinding grid model the path is painted on.
+ * @param path The tracker holding the previously painted cells.
+ * @param chain Every cell of the new path, start side first (start/end are skipped).
+ */
+void setLivePath(GridModel& grid, LivePath& path, const std::vector<int>& chain);
+
+/**
+ * @brief Forgets the painted cells without touching the grid (used between runs).
+ * @param path The tracker to reset.
+ */
+void resetLivePath(LivePath& path);
+
+#endif // LIVEPATH_H
@@ -4,76 +4,450 @@
 //
 // AUTHOR: Arpit Jatav
 //
-// DESCRIPTION: Implements the step-by-step logic for the Randomized Depth-First
-// Search (DFS) maze generation algorithm.
+// DESCRIPTION: Implements the step-by-step logic for the maze generators:
+// Randomized Depth-First Search (DFS), Kruskal, Prim, Wilson, recursive division
+// and Eller.
 //
 // ===================================================================================
 #include "MazeGenerator.h"
-#include <random>
-#include <algorithm>
+
+// The four moves between maze cells, two grid cells at a time: up, down, left, right.
+static const int DR[] = {-2, 2, 0, 0};
+static const int DC[] = {0, 0, -2, 2};
+
+const char* mazeKindName(MazeKind kind) {
+    switch (kind) {
+        case MazeKind::DFS:      return "DFS";
+        case MazeKind::Kruskal:  return "Kruskal";
+        case MazeKind::Prim:     return "Prim";
+        case MazeKind::Wilson:   return "Wilson";
+        case MazeKind::Division: return "Division";
+        case MazeKind::Eller:    return "Eller";
+    }
+    return "DFS";
+}
+
+static inline bool testBit(const std::vector<std::uint64_t>& bits, int cell) {
+    return (bits[cell >> 6] >> (cell & 63)) & 1;
+}
+
+static inline void setBit(std::vector<std::uint64_t>& bits, int cell) {
+    bits[cell >> 6] |= std::uint64_t(1) << (cell & 63);
+}
+
+// The grid cell of maze cell 'm', and the maze cell of grid cell 'cell'.
+static inline int gridCellOf(const GridModel& grid, const MazeGeneratorState& state, int m) {
+    return grid.index((m / state.mazeCols) * 2, (m % state.mazeCols) * 2);
+}
+
+static inline int mazeCellOf(const GridModel& grid, const MazeGeneratorState& state, int cell) {
+    return (grid.rowOf(cell) / 2) * state.mazeCols + grid.colOf(cell) / 2;
+}
+
+// A random number below 'n'. The engine's raw output is the same on every platform (a
+// distribution's mapping is not), so a seed gives the same maze everywhere.
+static inline int pick(MazeGeneratorState& state, int n) {
+    return static_cast<int>(state.rng() % static_cast<unsigned>(n));
+}
+
+// Opens the passage between two neighbouring maze cells and both cells. The passage
+// is halfway between them in the grid's index space too.
+static inline void carvePassage(GridModel& grid, int from, int to) {
+    grid.setType((from + to) / 2, NodeType::Empty);
+    grid.setType(from, NodeType::Empty);
+    grid.setType(to, NodeType::Empty);
+}
+
+// Union-find root with path halving.
+static int findRoot(std::vector<int>& parent, int x) {
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
 
 /**
  * @brief Performs one step of the Randomized DFS maze generation.
  * This version directly carves empty paths into a grid filled with walls.
  */
-void mazeStep(Grid& grid, MazeGeneratorState& state) {
-    // If generation is not active or the stack is empty, the maze is complete.
-    if (!state.isGenerating || state.stack.empty()) {
+static void dfsMazeStep(GridModel& grid, MazeGeneratorState& state) {
+    // If the stack is empty, the maze is complete.
+    if (state.stack.empty()) {
         state.isGenerating = false;
         return;
     }
 
     // 1. Get the current cell from the top of the stack.
-    Node* current = state.stack.top();
-    
-    // 2. Find all unvisited neighbors that are two cells away.
+    int current = state.stack.back();
+
+    // 2. Find all uncarved neighbors that are two cells away.
     //    Checking two cells away is the key to creating paths with walls in between.
-    std::vector<Node*> neighbors;
-    int r = current->row;
-    int c = current->col;
-    int dr[] = {-2, 2, 0, 0}; // Check up, down, left, right by 2 cells.
-    int dc[] = {0, 0, -2, 2};
-
-    for(int i = 0; i < 4; ++i) {
-        int new_r = r + dr[i];
-        int new_c = c + dc[i];
-        // A valid neighbor must be within the grid and must still be a wall.
-        if (grid.isValid(new_r, new_c) && grid.nodes[new_r][new_c].type == NodeType::Wall) {
-            neighbors.push_back(&grid.nodes[new_r][new_c]);
+    int neighbors[4];
+    int count = 0;
+    int r = grid.rowOf(current);
+    int c = grid.colOf(current);
+
+    for (int i = 0; i < 4; ++i) {
+        int new_r = r + DR[i];
+        int new_c = c + DC[i];
+        // A valid neighbor must be within the grid and must not have been carved yet.
+        if (grid.isValid(new_r, new_c) && !testBit(state.carved, grid.index(new_r, new_c))) {
+            neighbors[count++] = grid.index(new_r, new_c);
         }
     }
 
-    // 3. If unvisited neighbors were found...
-    if (!neighbors.empty()) {
+    // 3. If uncarved neighbors were found...
+    if (count > 0) {
         // ...choose one of them randomly.
-        std::random_device rd;
-        std::mt19937 g(rd());
-        std::shuffle(neighbors.begin(), neighbors.end(), g);
-        Node* next = neighbors[0];
+        int next = neighbors[pick(state, count)];
 
         // 4. Carve a path between the current cell and the chosen neighbor.
         //    This involves turning both the neighbor cell and the wall between them into empty paths.
-        int wall_r = r + (next->row - r) / 2;
-        int wall_c = c + (next->col - c) / 2;
-        
-        grid.setNodeType(wall_r, wall_c, NodeType::Empty);
-        grid.setNodeType(next->row, next->col, NodeType::Empty);
+        carvePassage(grid, current, next);
+        setBit(state.carved, next);
 
         // 5. Push the chosen neighbor to the stack to become the new current cell.
-        state.stack.push(next);
+        state.stack.push_back(next);
     } else {
-        // 6. If there are no unvisited neighbors, this path is a dead end. Backtrack.
+        // 6. If there are no uncarved neighbors, this path is a dead end. Backtrack.
         //    Pop the current cell from the stack to return to the previous cell.
-        state.stack.pop();
+        state.stack.pop_back();
+    }
+}
+
+/**
+ * @brief Kruskal: tries the shuffled passages in turn and opens the first one that
+ * joins two unconnected parts of the maze.
+ */
+static void kruskalMazeStep(GridModel& grid, MazeGeneratorState& state) {
+    while (state.nextPassage < state.passages.size()) {
+        int passage = state.passages[state.nextPassage++];
+        // A passage on an odd row joins the cells above and below it, otherwise the
+        // cells to its left and right.
+        bool vertical = grid.rowOf(passage) % 2 == 1;
+        int a = vertical ? passage - grid.cols : passage - 1;
+        int b = vertical ? passage + grid.cols : passage + 1;
+        int rootA = findRoot(state.parent, mazeCellOf(grid, state, a));
+        int rootB = findRoot(state.parent, mazeCellOf(grid, state, b));
+        if (rootA == rootB) continue; // Already connected: this passage would close a loop.
+        state.parent[rootA] = rootB;
+        carvePassage(grid, a, b);
+        return;
+    }
+    state.isGenerating = false;
+}
+
+// Adds the uncarved, unlisted neighbours of 'cell' to Prim's frontier.
+static void addFrontier(const GridModel& grid, MazeGeneratorState& state, int cell) {
+    int r = grid.rowOf(cell);
+    int c = grid.colOf(cell);
+    for (int i = 0; i < 4; ++i) {
+        if (!grid.isValid(r + DR[i], c + DC[i])) continue;
+        int neighbor = grid.index(r + DR[i], c + DC[i]);
+        if (testBit(state.carved, neighbor) || testBit(state.listed, neighbor)) continue;
+        setBit(state.listed, neighbor);
+        state.frontier.push_back(neighbor);
+    }
+}
+
+/**
+ * @brief Prim: takes a random frontier cell and joins it to a random neighbour that
+ * is already part of the maze.
+ */
+static void primMazeStep(GridModel& grid, MazeGeneratorState& state) {
+    if (state.frontier.empty()) {
+        state.isGenerating = false;
+        return;
+    }
+    // Swap-remove a random entry, so taking one costs O(1).
+    int i = pick(state, static_cast<int>(state.frontier.size()));
+    int cell = state.frontier[i];
+    state.frontier[i] = state.frontier.back();
+    state.frontier.pop_back();
+
+    int inMaze[4];
+    int count = 0;
+    int r = grid.rowOf(cell);
+    int c = grid.colOf(cell);
+    for (int k = 0; k < 4; ++k) {
+        if (!grid.isValid(r + DR[k], c + DC[k])) continue;
+        int neighbor = grid.index(r + DR[k], c + DC[k]);
+        if (testBit(state.carved, neighbor)) inMaze[count++] = neighbor;
+    }
+    // A frontier cell always has a carved neighbour: that is how it got listed.
+    carvePassage(grid, inMaze[pick(state, count)], cell);
+    setBit(state.carved, cell);
+    addFrontier(grid, state, cell);
+}
+
+/**
+ * @brief Wilson: random-walks from the next cell outside the maze until the walk
+ * hits the maze, then carves the walk with its loops erased.
+ */
+static void wilsonMazeStep(GridModel& grid, MazeGeneratorState& state) {
+    int mazeCells = state.mazeRows * state.mazeCols;
+    while (state.nextWalkStart < mazeCells && testBit(state.carved, gridCellOf(grid, state, state.nextWalkStart))) {
+        state.nextWalkStart++;
+    }
+    if (state.nextWalkStart == mazeCells) {
+        state.isGenerating = false;
+        return;
+    }
+
+    // 1. Walk, remembering only the direction each cell was last left in: when the
+    //    walk crosses itself, the newer direction skips the loop.
+    int start = gridCellOf(grid, state, state.nextWalkStart);
+    for (int cell = start; !testBit(state.carved, cell);) {
+        int moves[4];
+        int count = 0;
+        int r = grid.rowOf(cell);
+        int c = grid.colOf(cell);
+        for (int i = 0; i < 4; ++i) {
+            if (grid.isValid(r + DR[i], c + DC[i])) moves[count++] = i;
+        }
+        int move = moves[pick(state, count)];
+        state.walkDirection[mazeCellOf(grid, state, cell)] = static_cast<std::uint8_t>(move);
+        cell = grid.index(r + DR[move], c + DC[move]);
+    }
+
+    // 2. Follow the directions from the start again, carving the loop-free path.
+    for (int cell = start; !testBit(state.carved, cell);) {
+        int move = state.walkDirection[mazeCellOf(grid, state, cell)];
+        int next = grid.index(grid.rowOf(cell) + DR[move], grid.colOf(cell) + DC[move]);
+        carvePassage(grid, cell, next);
+        setBit(state.carved, cell);
+        cell = next;
     }
 }
 
+/**
+ * @brief Recursive division: splits the next chamber with a wall that has a single
+ * gap, and queues both halves.
+ */
+static void divisionMazeStep(GridModel& grid, MazeGeneratorState& state) {
+    while (!state.chambers.empty()) {
+        MazeChamber chamber = state.chambers.back();
+        state.chambers.pop_back();
+        if (chamber.rows < 2 && chamber.cols < 2) continue; // A single cell: nothing to split.
+
+        // Cut across the longer side, so the chambers stay roughly square.
+        bool horizontal = chamber.cols < 2 || (chamber.rows >= 2 && (chamber.rows > chamber.cols ||
+                                                                     (chamber.rows == chamber.cols && pick(state, 2) == 0)));
+        if (horizontal) {
+            // A wall between maze rows 'split' and 'split + 1', open at one column.
+            int split = chamber.row + pick(state, chamber.rows - 1);
+            int gap = chamber.col + pick(state, chamber.cols);
+            for (int mc = chamber.col; mc < chamber.col + chamber.cols; ++mc) {
+                if (mc != gap) grid.setType(grid.index(2 * split + 1, 2 * mc), NodeType::Wall);
+            }
+            state.chambers.push_back({chamber.row, chamber.col, split - chamber.row + 1, chamber.cols});
+            state.chambers.push_back({split + 1, chamber.col, chamber.row + chamber.rows - split - 1, chamber.cols});
+        } else {
+            int split = chamber.col + pick(state, chamber.cols - 1);
+            int gap = chamber.row + pick(state, chamber.rows);
+            for (int mr = chamber.row; mr < chamber.row + chamber.rows; ++mr) {
+                if (mr != gap) grid.setType(grid.index(2 * mr, 2 * split + 1), NodeType::Wall);
+            }
+            state.chambers.push_back({chamber.row, chamber.col, chamber.rows, split - chamber.col + 1});
+            state.chambers.push_back({chamber.row, split + 1, chamber.rows, chamber.col + chamber.cols - split - 1});
+        }
+        return;
+    }
+    state.isGenerating = false;
+}
+
+/**
+ * @brief Eller: builds one row. Cells not yet in a set get a new one, neighbouring
+ * cells in different sets are joined at random, and every set sends at least one
+ * cell down to the next row. The last row joins everything that is still apart.
+ */
+static void ellerMazeStep(GridModel& grid, MazeGeneratorState& state) {
+    if (state.ellerRow >= state.mazeRows) {
+        state.isGenerating = false;
+        return;
+    }
+    int width = state.mazeCols;
+    int row = 2 * state.ellerRow;
+    bool lastRow = state.ellerRow == state.mazeRows - 1;
+
+    // 1. Give every cell a set; carried-over labels are 0 .. ellerLabels-1, and there
+    //    are never more sets than cells in the row.
+    int labels = state.ellerLabels;
+    for (int j = 0; j < width; ++j) {
+        if (state.rowSet[j] < 0) state.rowSet[j] = labels++;
+        grid.setType(grid.index(row, 2 * j), NodeType::Empty);
+    }
+    for (int l = 0; l < labels; ++l) state.setParent[l] = l;
+
+    // 2. Join neighbours that are in different sets: at random, or always on the last row.
+    for (int j = 0; j + 1 < width; ++j) {
+        int a = findRoot(state.setParent, state.rowSet[j]);
+        int b = findRoot(state.setParent, state.rowSet[j + 1]);
+        if (a == b || (!lastRow && pick(state, 2) == 0)) continue;
+        state.setParent[a] = b;
+        grid.setType(grid.index(row, 2 * j + 1), NodeType::Empty);
+    }
+    if (lastRow) {
+        state.ellerRow++;
+        state.isGenerating = false;
+        return;
+    }
+
+    // 3. Send cells down at random, keeping a random member of each set (reservoir
+    //    sampling) for sets that sent none.
+    for (int l = 0; l < labels; ++l) {
+        state.setSize[l] = 0;
+        state.setDown[l] = 0;
+    }
+    for (int j = 0; j < width; ++j) {
+        int set = findRoot(state.setParent, state.rowSet[j]);
+        if (pick(state, ++state.setSize[set]) == 0) state.setPick[set] = j;
+        bool down = pick(state, 2) == 0;
+        state.nextRowSet[j] = down ? set : -1;
+        if (down) state.setDown[set]++;
+    }
+    for (int j = 0; j < width; ++j) {
+        int set = findRoot(state.setParent, state.rowSet[j]);
+        if (state.setDown[set] == 0) {
+            state.nextRowSet[state.setPick[set]] = set;
+            state.setDown[set] = 1;
+        }
+    }
+
+    // 4. Open the passages down, and relabel the carried-over sets 0, 1, 2 ... so the
+    //    labels stay below the row's width (setSize doubles as the relabelling table).
+    for (int l = 0; l < labels; ++l) state.setSize[l] = -1;
+    state.ellerLabels = 0;
+    for (int j = 0; j < width; ++j) {
+        int set = state.nextRowSet[j];
+        if (set < 0) {
+            state.rowSet[j] = -1;
+            continue;
+        }
+        grid.setType(grid.index(row + 1, 2 * j), NodeType::Empty);
+        if (state.setSize[set] < 0) state.setSize[set] = state.ellerLabels++;
+        state.rowSet[j] = state.setSize[set];
+    }
+    state.ellerRow++;
+}
+
+void startMaze(GridModel& grid, MazeGeneratorState& state, int startCell, unsigned seed) {
+    state.seed = seed;
+    state.rng.seed(seed);
+    // A maze cell sits on every even row and column; an even grid size leaves its last
+    // row or column as an outer wall.
+    state.mazeRows = (grid.rows + 1) / 2;
+    state.mazeCols = (grid.cols + 1) / 2;
+    int mazeCells = state.mazeRows * state.mazeCols;
+    int words = (grid.size() + 63) / 64;
+
+    switch (state.kind) {
+        case MazeKind::DFS:
+            state.stack.clear();
+            state.carved.assign(words, 0);
+            grid.setType(startCell, NodeType::Empty);
+            setBit(state.carved, startCell);
+            state.stack.push_back(startCell);
+            break;
+        case MazeKind::Kruskal:
+            state.passages.clear();
+            for (int m = 0; m < mazeCells; ++m) {
+                int cell = gridCellOf(grid, state, m);
+                if (m % state.mazeCols + 1 < state.mazeCols) state.passages.push_back(cell + 1);
+                if (m / state.mazeCols + 1 < state.mazeRows) state.passages.push_back(cell + grid.cols);
+            }
+            // Fisher-Yates, with the same engine as everything else.
+            for (int i = static_cast<int>(state.passages.size()) - 1; i > 0; --i) {
+                std::swap(state.passages[i], state.passages[pick(state, i + 1)]);
+            }
+            state.nextPassage = 0;
+            state.parent.resize(mazeCells);
+            for (int m = 0; m < mazeCells; ++m) state.parent[m] = m;
+            if (state.passages.empty()) grid.setType(gridCellOf(grid, state, 0), NodeType::Empty);
+            break;
+        case MazeKind::Prim:
+            state.frontier.clear();
+            state.carved.assign(words, 0);
+            state.listed.assign(words, 0);
+            grid.setType(startCell, NodeType::Empty);
+            setBit(state.carved, startCell);
+            addFrontier(grid, state, startCell);
+            break;
+        case MazeKind::Wilson:
+            state.carved.assign(words, 0);
+            state.walkDirection.resize(mazeCells);
+            state.nextWalkStart = 0;
+            grid.setType(startCell, NodeType::Empty);
+            setBit(state.carved, startCell);
+            break;
+        case MazeKind::Division:
+            // Start from an open maze, every passage open, and add walls from there.
+            for (int r = 0; r < 2 * state.mazeRows - 1; ++r) {
+                for (int c = 0; c < 2 * state.mazeCols - 1; ++c) {
+                    if (r % 2 == 0 || c % 2 == 0) grid.setType(grid.index(r, c), NodeType::Empty);
+                }
+            }
+            state.chambers.clear();
+            state.chambers.push_back({0, 0, state.mazeRows, state.mazeCols});
+            break;
+        case MazeKind::Eller:
+            state.ellerRow = 0;
+            state.ellerLabels = 0;
+            state.rowSet.assign(state.mazeCols, -1);
+            state.nextRowSet.resize(state.mazeCols);
+            state.setParent.resize(state.mazeCols);
+            state.setSize.resize(state.mazeCols);
+            state.setPick.resize(state.mazeCols);
+            state.setDown.resize(state.mazeCols);
+            break;
+    }
+    state.isGenerating = true;
+}
+
+void mazeStep(GridModel& grid, MazeGeneratorState& state) {
+    // If generation is not active, there is nothing left to carve.
+    if (!state.isGenerating) return;
+    switch (state.kind) {
+        case MazeKind::DFS:      dfsMazeStep(grid, state); break;
+        case MazeKind::Kruskal:  kruskalMazeStep(grid, state); break;
+        case MazeKind::Prim:     primMazeStep(grid, state); break;
+        case MazeKind::Wilson:   wilsonMazeStep(grid, state); break;
+        case MazeKind::Division: divisionMazeStep(grid, state); break;
+        case MazeKind::Eller:    ellerMazeStep(grid, state); break;
+    }
+}
+
+void generateMaze(GridModel& grid, MazeGeneratorState& state, int startCell, unsigned seed) {
+    startMaze(grid, state, startCell, seed);
+    while (state.isGenerating) mazeStep(grid, state);
+}
+
+template <typename T>
+static std::size_t bytesOf(const std::vector<T>& v) {
+    return v.capacity() * sizeof(T);
+}
+
+std::size_t mazeGeneratorBytes(const MazeGeneratorState& state) {
+    return bytesOf(state.stack) + bytesOf(state.carved) + bytesOf(state.passages) + bytesOf(state.parent) +
+           bytesOf(state.frontier) + bytesOf(state.listed) + bytesOf(state.walkDirection) + bytesOf(state.chambers) +
+           bytesOf(state.rowSet) + bytesOf(state.nextRowSet) + bytesOf(state.setParent) + bytesOf(state.setSize) +
+           bytesOf(state.setPick) + bytesOf(state.setDown);
+}
+
 /**
  * @brief Resets the maze generator state for a new maze.
  */
 void resetMazeGenerator(MazeGeneratorState& state) {
     state.isGenerating = false;
-    // Efficiently clear the stack by swapping it with an empty one.
-    std::stack<Node*> empty;
-    state.stack.swap(empty);
-}
\ No newline at end of file
+    // Keep the capacity: the next maze of the same size reuses it.
+    state.stack.clear();
+    state.carved.clear();
+    state.passages.clear();
+    state.nextPassage = 0;
+    state.frontier.clear();
+    state.listed.clear();
+    state.chambers.clear();
+    state.ellerRow = 0;
+    state.ellerLabels = 0;
+}
@@ -4,38 +4,143 @@
 //
 // AUTHOR: Arpit Jatav
 //
-// DESCRIPTION: Header file for the Randomized Depth-First Search (DFS) maze
-// generator. Defines the state object and function prototypes required for the
-// step-by-step creation of a random maze.
+// DESCRIPTION: Header file for the maze generators: randomized depth-first search,
+// Kruskal's, Prim's and Wilson's algorithms, recursive division and Eller's
+// algorithm. Defines the state object and function prototypes required for the
+// step-by-step creation of a random maze. Every generator draws from one seeded
+// random engine, so the same seed always carves the same maze.
+//
+// All of them lay the maze out the same way: a maze cell sits on every even row and
+// even column, and the cell between two neighbouring maze cells is the passage
+// that joins them (or the wall that separates them).
 //
 // ===================================================================================
 #ifndef MAZEGENERATOR_H
 #define MAZEGENERATOR_H
 
-#include "Grid.h"
-#include <stack>
+#include "GridModel.h"
+#include <cstddef>
+#include <cstdint>
+#include <random>
 #include <vector>
 
+// The available generators.
+//   DFS:      a carver that walks until it is stuck and then backtracks; long, winding
+//             corridors with few branches. Its stack can hold a quarter of the cells.
+//   Kruskal:  opens the passages in random order, each one only if it joins two parts
+//             of the maze that are not connected yet (union-find); many short dead ends.
+//   Prim:     grows the maze from the start cell, opening a random cell of its
+//             frontier each step; short branches radiating from the start.
+//   Wilson:   loop-erased random walks from each cell until they reach the maze; every
+//             spanning tree is equally likely, so it has no bias at all.
+//   Division: starts with no inner walls and splits chambers in two with a wall that
+//             has one gap; long straight walls, a visibly boxy layout.
+//   Eller:    one row at a time, keeping only the current row's sets, so it needs
+//             memory for one row whatever the height of the maze.
+enum class MazeKind { DFS, Kruskal, Prim, Wilson, Division, Eller };
+const int MAZE_KIND_COUNT = 6;
+
+const char* mazeKindName(MazeKind kind);
+
+/**
+ * @brief A rectangle of maze cells that recursive division has yet to split.
+ */
+struct MazeChamber {
+    int row, col;   // Top-left maze cell.
+    int rows, cols; // Size in maze cells.
+};
+
 /**
  * @brief Holds all state information for a maze generation process in progress.
  *
- * This struct uses a stack to manage the path of the Randomized DFS algorithm,
- * simulating a "carver" that moves through a solid grid of walls.
+ * Each generator uses its own members below; the others stay empty. A step
+ * allocates nothing beyond growing those members, and they keep their capacity
+ * between mazes, so their capacity after a maze is also their peak size.
  */
 struct MazeGeneratorState {
-    // The stack holds the current path of the carver. The top of the stack is the current cell.
-    std::stack<Node*> stack;
-    
+    MazeKind kind = MazeKind::DFS;   // The generator startMaze() sets up.
+
+    // The seed of the current maze and the engine seeded with it.
+    unsigned seed = 0;
+    std::mt19937 rng;
+
+    // The maze's size in maze cells (a cell on every even row and column).
+    int mazeRows = 0, mazeCols = 0;
+
+    // DFS: the stack holds the current path of the carver (as cell indices). The back of the stack is the current cell.
+    std::vector<int> stack;
+
+    // DFS, Prim and Wilson: one bit per grid cell, set once the cell has been opened as
+    // part of the maze. A cell is only carved into while its bit is clear, whatever is
+    // drawn over the grid meanwhile.
+    std::vector<std::uint64_t> carved;
+
+    // Kruskal: every passage cell in shuffled order, the next one to try, and the
+    // union-find forest over maze cells (a root is its own parent).
+    std::vector<int> passages;
+    std::size_t nextPassage = 0;
+    std::vector<int> parent;
+
+    // Prim: the uncarved cells next to the maze, with a bit per grid cell for
+    // "already in the frontier".
+    std::vector<int> frontier;
+    std::vector<std::uint64_t> listed;
+
+    // Wilson: the direction the current walk last left each maze cell in (loop erasure
+    // comes for free, as a revisited cell just overwrites its direction), and the next
+    // cell to scan for a walk start.
+    std::vector<std::uint8_t> walkDirection;
+    int nextWalkStart = 0;
+
+    // Division: the chambers still to split.
+    std::vector<MazeChamber> chambers;
+
+    // Eller: the row being built and, per maze column, its set label in this row and
+    // the next (-1 = not in a set yet). The other arrays are per-label scratch (labels
+    // are below mazeCols): a small union-find forest, and per set its cell count, a
+    // random member and how many of its cells go down.
+    int ellerRow = 0;
+    int ellerLabels = 0;
+    std::vector<int> rowSet, nextRowSet;
+    std::vector<int> setParent, setSize, setPick, setDown;
+
     // A flag to track if the generation animation is currently active.
     bool isGenerating = false;
 };
 
 /**
- * @brief Performs a single step of the maze generation algorithm.
- * @param grid The main pathfinding grid (passed by reference).
+ * @brief Starts a new maze from a grid already filled with walls.
+ * @param grid The pathfinding grid model (passed by reference).
+ * @param state The maze generator state to start; its 'kind' picks the generator.
+ * @param startCell The cell DFS, Prim and Wilson grow the maze from (on an even row
+ * and column); the other generators ignore it.
+ * @param seed The seed of the random engine; equal seeds give equal mazes.
+ */
+void startMaze(GridModel& grid, MazeGeneratorState& state, int startCell, unsigned seed);
+
+/**
+ * @brief Performs a single step of the maze generation algorithm: one cell for DFS
+ * and Prim, one passage for Kruskal, one loop-erased walk for Wilson, one wall for
+ * recursive division and one row for Eller.
+ * @param grid The pathfinding grid model (passed by reference).
  * @param state The current state of the maze generator (passed by reference).
  */
-void mazeStep(Grid& grid, MazeGeneratorState& state);
+void mazeStep(GridModel& grid, MazeGeneratorState& state);
+
+/**
+ * @brief Generates a whole maze at once, without stopping between steps.
+ * @param grid The pathfinding grid model, already filled with walls.
+ * @param state The maze generator state; its 'kind' picks the generator.
+ * @param startCell As for startMaze().
+ * @param seed As for startMaze().
+ */
+void generateMaze(GridModel& grid, MazeGeneratorState& state, int startCell, unsigned seed);
+
+/**
+ * @brief The bytes the generator's arrays hold (their capacity), which after a maze
+ * is the peak they reached while making it.
+ */
+std::size_t mazeGeneratorBytes(const MazeGeneratorState& state);
 
 /**
  * @brief Resets the maze generator state to its default values for a new maze.
@@ -43,4 +148,4 @@ void mazeStep(Grid& grid, MazeGeneratorState& state);
  */
 void resetMazeGenerator(MazeGeneratorState& state);
 
-#endif // MAZEGENERATOR_H
\ No newline at end of file
+#endif // MAZEGENERATOR_H
@@ -0,0 +1,303 @@
+// ===================================================================================
+// == FILE: src/MonotoneQueue.cpp ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Implements the binary heap, indexed 4-ary heap, circular bucket
+// queue and radix heap behind MonotoneQueue.
+//
+// ===================================================================================
+#include "MonotoneQueue.h"
+#include <algorithm>
+#include <functional>
+
+// Up to this key step a bucket queue wins: popping scans at most this many empty
+// buckets. Larger steps (fixed-point or heavy weights) go to the radix heap.
+static const int MAX_BUCKET_STEP = 64;
+
+// 32 slots for the bits of a key, plus slot 0 for keys equal to the last one popped.
+static const int RADIX_SLOTS = 33;
+
+const char* queueKindName(QueueKind kind) {
+    switch (kind) {
+        case QueueKind::Auto: return "Auto";
+        case QueueKind::BinaryHeap: return "Heap";
+        case QueueKind::QuaternaryHeap: return "4-ary Heap";
+        case QueueKind::Bucket: return "Bucket";
+        case QueueKind::Radix: return "Radix";
+    }
+    return "";
+}
+
+void MonotoneQueue::reset(QueueKind kind, int maxStep, int cellCount) {
+    if (maxStep < 1) maxStep = 1;
+    if (kind == QueueKind::Auto) kind = maxStep <= MAX_BUCKET_STEP ? QueueKind::Bucket : QueueKind::Radix;
+
+    // Forget the cells still queued by the last run while the old structure is known.
+    clear();
+    active = kind;
+
+    if (static_cast<int>(where.size()) != cellCount) {
+        where.assign(cellCount, -1);
+        queuedKey.resize(cellCount);
+    }
+    if (active == QueueKind::Bucket && static_cast<int>(buckets.size()) < maxStep + 1) {
+        buckets.resize(maxStep + 1);
+    }
+    if (active == QueueKind::Radix && radix.size() != RADIX_SLOTS) {
+        radix.resize(RADIX_SLOTS);
+    }
+}
+
+void MonotoneQueue::clear() {
+    // Only the cells still queued have an index to undo, so this is O(size), not
+    // O(cells). Clearing keeps every vector's capacity for the next run.
+    if (indexed()) {
+        for (const QueueEntry& entry : quad) where[entry.node] = -1;
+        for (const std::vector<QueueEntry>& bucket : buckets)
+            for (const QueueEntry& entry : bucket) where[entry.node] = -1;
+        for (const std::vector<QueueEntry>& slot : radix)
+            for (const QueueEntry& entry : slot) where[entry.node] = -1;
+    }
+    heap.clear();
+    quad.clear();
+    for (std::vector<QueueEntry>& bucket : buckets) bucket.clear();
+    for (std::vector<QueueEntry>& slot : radix) slot.clear();
+    count = 0;
+    cursor = -1;
+    last = 0;
+    stats = QueueStats();
+}
+
+bool MonotoneQueue::contains(int node) const {
+    return indexed() && where[node] >= 0;
+}
+
+// The slot of a key is the bit length of (key XOR last): 0 when they are equal.
+int MonotoneQueue::radixSlot(unsigned key, unsigned last) {
+    unsigned diff = key ^ last;
+    if (diff == 0) return 0;
+#if defined(__GNUC__)
+    return 32 - __builtin_clz(diff);
+#else
+    int bits = 0;
+    while (diff) {
+        bits++;
+        diff >>= 1;
+    }
+    return bits;
+#endif
+}
+
+// The bucket or radix slot that holds a (clamped) key.
+std::vector<QueueEntry>& MonotoneQueue::listOf(int key) {
+    if (active == QueueKind::Bucket) return buckets[key % buckets.size()];
+    return radix[radixSlot(key, last)];
+}
+
+// Buckets and radix[0] hold one key each and are binary min-heaps on the tie,
+// kept in step with 'where'; the higher radix slots are unordered.
+bool MonotoneQueue::ordered(const std::vector<QueueEntry>& list) const {
+    return active == QueueKind::Bucket || &list == &radix[0];
+}
+
+// Restore a list's heap order after the entry at 'position' changed.
+void MonotoneQueue::liftInList(std::vector<QueueEntry>& list, int position) {
+    QueueEntry entry = list[position];
+    while (position > 0) {
+        int parent = (position - 1) / 2;
+        if (!(list[parent] > entry)) break;
+        list[position] = list[parent];
+        where[list[position].node] = position;
+        position = parent;
+    }
+    list[position] = entry;
+    where[entry.node] = position;
+}
+
+void MonotoneQueue::sinkInList(std::vector<QueueEntry>& list, int position) {
+    QueueEntry entry = list[position];
+    int size = static_cast<int>(list.size());
+    while (true) {
+        int best = 2 * position + 1;
+        if (best >= size) break;
+        if (best + 1 < size && list[best] > list[best + 1]) best++;
+        if (!(entry > list[best])) break;
+        list[position] = list[best];
+        where[list[position].node] = position;
+        position = best;
+    }
+    list[position] = entry;
+    where[entry.node] = position;
+}
+
+// Adds a cell to a bucket or radix slot and records where it went.
+void MonotoneQueue::place(std::vector<QueueEntry>& list, const QueueEntry& entry) {
+    where[entry.node] = static_cast<int>(list.size());
+    queuedKey[entry.node] = entry.key;
+    list.push_back(entry);
+    if (ordered(list)) liftInList(list, static_cast<int>(list.size()) - 1);
+}
+
+// Removes the entry at 'position' by moving the list's last entry into its place.
+void MonotoneQueue::unlink(std::vector<QueueEntry>& list, int position) {
+    where[list[position].node] = -1;
+    QueueEntry moved = list.back();
+    list.pop_back();
+    if (position == static_cast<int>(list.size())) return;
+    list[position] = moved;
+    where[moved.node] = position;
+    if (!ordered(list)) return;
+    liftInList(list, position);
+    sinkInList(list, where[moved.node]);
+}
+
+void MonotoneQueue::siftUp(int position) {
+    QueueEntry entry = quad[position];
+    while (position > 0) {
+        int parent = (position - 1) / 4;
+        if (!(quad[parent] > entry)) break;
+        quad[position] = quad[parent];
+        where[quad[position].node] = position;
+        position = parent;
+    }
+    quad[position] = entry;
+    where[entry.node] = position;
+}
+
+void MonotoneQueue::siftDown(int position) {
+    QueueEntry entry = quad[position];
+    int size = static_cast<int>(quad.size());
+    while (true) {
+        int first = 4 * position + 1;
+        if (first >= size) break;
+        int best = first;
+        int end = std::min(first + 4, size);
+        for (int child = first + 1; child < end; ++child) {
+            if (quad[best] > quad[child]) best = child;
+        }
+        if (!(entry > quad[best])) break;
+        quad[position] = quad[best];
+        where[quad[position].node] = position;
+        position = best;
+    }
+    quad[position] = entry;
+    where[entry.node] = position;
+}
+
+/**
+ * @brief Makes room for a key that lies too far past the cursor. Only happens when a
+ * search was given too small a maxStep; every entry is re-bucketed once.
+ */
+void MonotoneQueue::growBuckets(int key) {
+    std::vector<QueueEntry> entries;
+    entries.reserve(count);
+    for (std::vector<QueueEntry>& bucket : buckets) {
+        entries.insert(entries.end(), bucket.begin(), bucket.end());
+        bucket.clear();
+    }
+    std::size_t size = std::max(buckets.size() * 2, static_cast<std::size_t>(key - cursor) + 1);
+    buckets.resize(size);
+    for (const QueueEntry& entry : entries) place(buckets[entry.key % size], entry);
+}
+
+// Lowers the key of a queued cell; a key that is not lower is ignored. The tie
+// value stays the one the cell was queued with.
+void MonotoneQueue::decreaseKey(int node, int key) {
+    if (active == QueueKind::Bucket && key < cursor) key = cursor;
+    if (active == QueueKind::Radix && static_cast<unsigned>(key) < last) key = static_cast<int>(last);
+    if (key >= queuedKey[node]) return;
+    stats.decreaseKeys++;
+
+    if (active == QueueKind::QuaternaryHeap) {
+        queuedKey[node] = key;
+        quad[where[node]].key = key;
+        siftUp(where[node]);
+        return;
+    }
+    // Bucket and radix: move the cell from the list of its old key to that of the new.
+    std::vector<QueueEntry>& from = listOf(queuedKey[node]);
+    QueueEntry entry = from[where[node]];
+    entry.key = key;
+    unlink(from, where[node]);
+    place(listOf(key), entry);
+}
+
+void MonotoneQueue::push(int node, int key, int tie) {
+    if (indexed() && where[node] >= 0) {
+        decreaseKey(node, key);
+        return;
+    }
+    switch (active) {
+        case QueueKind::Auto:
+        case QueueKind::BinaryHeap:
+            heap.push_back({node, key, tie});
+            std::push_heap(heap.begin(), heap.end(), std::greater<QueueEntry>());
+            break;
+        case QueueKind::QuaternaryHeap:
+            queuedKey[node] = key;
+            quad.push_back({node, key, tie});
+            siftUp(static_cast<int>(quad.size()) - 1);
+            break;
+        case QueueKind::Bucket:
+            if (cursor < 0) cursor = key; // The first key of a run starts the sweep.
+            if (key < cursor) key = cursor;
+            if (key - cursor >= static_cast<int>(buckets.size())) growBuckets(key);
+            place(buckets[key % buckets.size()], {node, key, tie});
+            break;
+        case QueueKind::Radix:
+            if (static_cast<unsigned>(key) < last) key = static_cast<int>(last);
+            place(radix[radixSlot(key, last)], {node, key, tie});
+            break;
+    }
+    count++;
+    stats.pushes++;
+    stats.peakSize = std::max(stats.peakSize, count);
+}
+
+QueueEntry MonotoneQueue::pop() {
+    QueueEntry top{-1, 0, 0};
+    switch (active) {
+        case QueueKind::Auto:
+        case QueueKind::BinaryHeap:
+            std::pop_heap(heap.begin(), heap.end(), std::greater<QueueEntry>());
+            top = heap.back();
+            heap.pop_back();
+            break;
+        case QueueKind::QuaternaryHeap:
+            top = quad.front();
+            quad.front() = quad.back();
+            quad.pop_back();
+            if (!quad.empty()) siftDown(0);
+            break;
+        case QueueKind::Bucket: {
+            // Walk to the next non-empty bucket; the cursor only ever moves forward.
+            while (buckets[cursor % buckets.size()].empty()) cursor++;
+            std::vector<QueueEntry>& bucket = buckets[cursor % buckets.size()];
+            top = bucket.front();
+            unlink(bucket, 0);
+            break;
+        }
+        case QueueKind::Radix:
+            if (radix[0].empty()) {
+                // Take the lowest non-empty slot, make its smallest key the new 'last'
+                // and spread the slot out again. Every entry moves to a lower slot, so
+                // each one is moved at most 32 times over its lifetime.
+                int i = 1;
+                while (radix[i].empty()) i++;
+                unsigned smallest = static_cast<unsigned>(radix[i].front().key);
+                for (const QueueEntry& entry : radix[i]) smallest = std::min(smallest, static_cast<unsigned>(entry.key));
+                last = smallest;
+                for (const QueueEntry& entry : radix[i]) place(radix[radixSlot(entry.key, last)], entry);
+                radix[i].clear();
+            }
+            top = radix[0].front();
+            unlink(radix[0], 0);
+            break;
+    }
+    if (indexed()) where[top.node] = -1;
+    count--;
+    stats.pops++;
+    return top;
+}
@@ -0,0 +1,137 @@
+// ===================================================================================
+// == FILE: src/MonotoneQueue.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Defines MonotoneQueue, the open set shared by A* and Dijkstra. Grid
+// costs are small integers and both searches pop keys that never go down, so besides
+// a comparison heap the queue can run as a circular bucket queue (Dial's algorithm)
+// when the largest key step is small, or as a radix heap when it is not. All but the
+// plain binary heap know where each cell sits, so a cell whose cost improves has its
+// key lowered in place instead of being queued a second time.
+//
+// ===================================================================================
+#ifndef MONOTONEQUEUE_H
+#define MONOTONEQUEUE_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief The structures a MonotoneQueue can run as. Auto picks one from the
+ * largest key step the search can make.
+ */
+enum class QueueKind { Auto, BinaryHeap, QuaternaryHeap, Bucket, Radix };
+
+/**
+ * @brief Returns the short name of a queue kind, for the UI and the benchmark.
+ */
+const char* queueKindName(QueueKind kind);
+
+/**
+ * @brief A cell, the key it was queued with and a tie-breaker for equal keys.
+ */
+struct QueueEntry {
+    int node;
+    int key;
+    int tie; // Among equal keys the smaller tie comes out first (A* passes H, favouring larger G).
+
+    // Overload the > operator so std::greater turns the heap into a min-heap.
+    bool operator>(const QueueEntry& other) const {
+        return key != other.key ? key > other.key : tie > other.tie;
+    }
+};
+
+/**
+ * @brief What the open set did during a run, for the stats panel.
+ */
+struct QueueStats {
+    long long pushes = 0;       // Cells added to the queue.
+    long long pops = 0;         // Entries taken off it.
+    long long decreaseKeys = 0; // Keys lowered in place (never counted by the binary heap).
+    std::size_t peakSize = 0;   // The most entries queued at once.
+};
+
+/**
+ * @brief A min-priority queue of cells for searches whose popped keys never decrease.
+ *
+ * The binary heap is the old open set: it keeps duplicates, and the caller skips a
+ * stale entry when it comes out. The indexed 4-ary heap, the bucket queue and the
+ * radix heap hold each cell at most once; pushing a queued cell lowers its key
+ * (a larger key is ignored). All four hand out equal keys smallest tie first: each
+ * bucket, and the radix slot of keys equal to the last one popped, is itself a
+ * small binary heap on the tie values, so the choice of structure never changes
+ * which of several equally good cells a search expands.
+ *
+ * The bucket queue and the radix heap rely on keys being monotone; a key below the
+ * last one popped (only possible with an inconsistent heuristic) is raised to it,
+ * so the search still ends but may expand that cell late. For the bucket queue the
+ * first key pushed counts as popped, which suits searches that start from one cell.
+ */
+class MonotoneQueue {
+public:
+    /**
+     * @brief Empties the queue and chooses the structure for the next search.
+     * Memory from earlier runs is kept.
+     * @param kind The requested structure (Auto chooses from maxStep).
+     * @param maxStep The largest amount a pushed key can exceed the last popped key by.
+     * @param cellCount The number of cells in the grid being searched.
+     */
+    void reset(QueueKind kind, int maxStep, int cellCount);
+
+    void clear();                                  // Empties the queue, keeping its structure.
+    void push(int node, int key, int tie = 0);     // Adds a cell, or lowers the key of a queued one.
+    QueueEntry pop();                              // Removes and returns an entry with the smallest key.
+    bool contains(int node) const;                 // Always false for the binary heap, which keeps no index.
+    bool empty() const { return count == 0; }
+    std::size_t size() const { return count; }
+    QueueKind kind() const { return active; }      // The structure in use (never Auto).
+
+    QueueStats stats; // Counters for the current run (cleared with the queue).
+
+private:
+    bool indexed() const { return active != QueueKind::BinaryHeap; }
+    void place(std::vector<QueueEntry>& list, const QueueEntry& entry);
+    void unlink(std::vector<QueueEntry>& list, int position);
+    bool ordered(const std::vector<QueueEntry>& list) const;
+    void liftInList(std::vector<QueueEntry>& list, int position);
+    void sinkInList(std::vector<QueueEntry>& list, int position);
+    std::vector<QueueEntry>& listOf(int key);
+    void decreaseKey(int node, int key);
+    void siftUp(int position);
+    void siftDown(int position);
+    void growBuckets(int key);
+    static int radixSlot(unsigned key, unsigned last);
+
+    QueueKind active = QueueKind::BinaryHeap;
+    std::size_t count = 0;
+
+    // where[cell]: the cell's position in its heap, bucket or radix slot, or -1 if it
+    // is not queued. queuedKey[cell] is its key while it is queued.
+    std::vector<int> where;
+    std::vector<int> queuedKey;
+
+    // Binary heap (std::push_heap/pop_heap), with duplicates.
+    std::vector<QueueEntry> heap;
+
+    // Indexed 4-ary heap: the children of position i are 4i + 1 ... 4i + 4. It is
+    // half as deep as a binary heap, which makes lowering a key (the common case)
+    // cheaper and keeps the four children in one cache line.
+    std::vector<QueueEntry> quad;
+
+    // Circular bucket queue: key k lives in buckets[k % buckets.size()]. Every queued
+    // key lies in [cursor, cursor + buckets.size()), so a bucket never mixes keys;
+    // within a bucket the entries form a heap on their tie values.
+    // The cursor is the last key popped (-1 until the run's first push).
+    std::vector<std::vector<QueueEntry>> buckets;
+    int cursor = -1;
+
+    // Radix heap: radix[0] holds keys equal to 'last'; radix[i] holds keys whose
+    // highest bit differing from 'last' is bit i - 1. Only radix[0] is kept in heap
+    // order; the other slots are plain lists until they are spread out.
+    std::vector<std::vector<QueueEntry>> radix;
+    unsigned last = 0;
+};
+
+#endif // MONOTONEQUEUE_H
@@ -0,0 +1,279 @@
+// ===================================================================================
+// == FILE: src/MovingAI.cpp ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Implements the Moving AI map and scenario loaders. Files are read
+// through a read-only memory mapping (CreateFileMapping on Windows, mmap elsewhere)
+// and parsed in place; nothing reads past the end of the mapping, which is not
+// NUL-terminated.
+//
+// ===================================================================================
+#include "MovingAI.h"
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+/**
+ * @brief A whole file mapped read-only into memory, unmapped on destruction.
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path) {
+#ifdef _WIN32
+        file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                           FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return;
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) return;
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) return;
+        data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (data) size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+            void* mapped = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped != MAP_FAILED) {
+                madvise(mapped, info.st_size, MADV_SEQUENTIAL);
+                data = static_cast<const char*>(mapped);
+                size = static_cast<std::size_t>(info.st_size);
+            }
+        }
+        close(fd);  // The mapping stays valid without the descriptor.
+#endif
+    }
+
+    ~MappedFile() {
+#ifdef _WIN32
+        if (data) UnmapViewOfFile(data);
+        if (mapping) CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+#else
+        if (data) munmap(const_cast<char*>(data), size);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data = nullptr;
+    std::size_t size = 0;
+
+private:
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#endif
+};
+
+/**
+ * @brief Reads whitespace-separated tokens from a mapped file.
+ */
+struct Cursor {
+    const char* at;
+    const char* end;
+
+    void skipSpace() {
+        while (at < end && (*at == ' ' || *at == '\t' || *at == '\r' || *at == '\n')) ++at;
+    }
+
+    // The next token, or an empty string at the end of the file.
+    std::string token() {
+        skipSpace();
+        const char* begin = at;
+        while (at < end && *at != ' ' && *at != '\t' && *at != '\r' && *at != '\n') ++at;
+        return std::string(begin, at);
+    }
+
+    // Reads a token as a non-negative integer; false if it is not one.
+    bool number(int& value) {
+        std::string text = token();
+        if (text.empty() || text.size() > 9) return false;
+        value = 0;
+        for (char ch : text) {
+            if (ch < '0' || ch > '9') return false;
+            value = value * 10 + (ch - '0');
+        }
+        return true;
+    }
+
+    // Reads a token as a decimal number; false if it is not one.
+    bool decimal(double& value) {
+        std::string text = token();
+        if (text.empty()) return false;
+        char* parsed = nullptr;
+        value = std::strtod(text.c_str(), &parsed);
+        return *parsed == '\0';
+    }
+};
+
+// Which map characters are open ground: '.', 'G' (grass) and 'S' (swamp).
+struct OpenTable {
+    bool open[256] = {};
+    OpenTable() {
+        for (unsigned char ch : {'.', 'G', 'S'}) open[ch] = true;
+    }
+};
+const OpenTable OPEN_CELLS;
+
+}  // namespace
+
+bool loadMovingAIMap(const std::string& path, GridModel& grid, std::string& error) {
+    MappedFile file(path);
+    if (!file.data) {
+        error = "cannot open " + path;
+        return false;
+    }
+    Cursor in{file.data, file.data + file.size};
+
+    // 1. The header: "type octile", "height H", "width W", "map" (height and width in
+    //    either order).
+    int height = -1, width = -1;
+    for (std::string word = in.token(); word != "map"; word = in.token()) {
+        if (word.empty()) {
+            error = path + ": no \"map\" line";
+            return false;
+        }
+        if (word == "type") {
+            in.token();
+        } else if (word == "height") {
+            if (!in.number(height)) height = -1;
+        } else if (word == "width") {
+            if (!in.number(width)) width = -1;
+        } else {
+            error = path + ": unexpected \"" + word + "\" in the header";
+            return false;
+        }
+    }
+    if (height < 1 || width < 1 || static_cast<long long>(height) * width > INT_MAX) {
+        error = path + ": missing or bad height/width";
+        return false;
+    }
+
+    // 2. The cells, one row per line. Only the line breaks between rows are skipped,
+    //    so a row is copied with a single pass over its bytes.
+    grid.resize(height, width);
+    NodeType* types = grid.types.data();
+    for (int row = 0; row < height; ++row) {
+        in.skipSpace();
+        if (in.end - in.at < width) {
+            error = path + ": the map stops at row " + std::to_string(row);
+            return false;
+        }
+        const unsigned char* cells = reinterpret_cast<const unsigned char*>(in.at);
+        NodeType* out = types + static_cast<std::size_t>(row) * width;
+        for (int col = 0; col < width; ++col) {
+            if (!OPEN_CELLS.open[cells[col]]) out[col] = NodeType::Wall;
+        }
+        in.at += width;
+    }
+
+    // Walls cost 1 like empty cells, so only the types changed. The resize already
+    // dropped the edit journal, so nothing is added to it.
+    grid.wallVersion++;
+    if (grid.trackChanges) {
+        for (int i = 0; i < grid.size(); ++i) {
+            if (types[i] == NodeType::Wall) grid.changedCells.push_back(i);
+        }
+    }
+    return true;
+}
+
+bool loadMovingAIScenarios(const std::string& path, std::vector<MovingAIScenario>& scenarios, std::string& error) {
+    scenarios.clear();
+    MappedFile file(path);
+    if (!file.data) {
+        error = "cannot open " + path;
+        return false;
+    }
+    Cursor in{file.data, file.data + file.size};
+
+    std::string version = in.token();
+    if (version == "version") {
+        in.token();  // Versions 1 and 1.0 share the same line layout.
+    } else {
+        in.at = file.data;  // Version 0 files have no header.
+    }
+
+    for (;;) {
+        MovingAIScenario scenario;
+        if (!in.number(scenario.bucket)) {
+            in.skipSpace();
+            if (in.at == in.end) return true;
+            error = path + ": bad bucket on query " + std::to_string(scenarios.size() + 1);
+            return false;
+        }
+        scenario.map = in.token();
+        if (!in.number(scenario.mapWidth) || !in.number(scenario.mapHeight) || !in.number(scenario.startX) ||
+            !in.number(scenario.startY) || !in.number(scenario.goalX) || !in.number(scenario.goalY) ||
+            !in.decimal(scenario.optimalLength)) {
+            error = path + ": bad query " + std::to_string(scenarios.size() + 1);
+            return false;
+        }
+        scenarios.push_back(scenario);
+    }
+}
+
+bool placeScenario(GridModel& grid, const MovingAIScenario& scenario) {
+    if (grid.startIndex >= 0) grid.setType(grid.startIndex, NodeType::Empty);
+    if (grid.endIndex >= 0) grid.setType(grid.endIndex, NodeType::Empty);
+    if (!grid.isValid(scenario.startY, scenario.startX) || !grid.isValid(scenario.goalY, scenario.goalX)) return false;
+    int start = grid.index(scenario.startY, scenario.startX);
+    int goal = grid.index(scenario.goalY, scenario.goalX);
+    if (grid.types[start] == NodeType::Wall || grid.types[goal] == NodeType::Wall || start == goal) return false;
+    grid.setType(start, NodeType::Start);
+    grid.setType(goal, NodeType::End);
+    return true;
+}
+
+double octileLength(const GridModel& grid, const std::vector<int>& path) {
+    double length = 0.0;
+    for (std::size_t i = 1; i < path.size(); ++i) {
+        int dr = std::abs(grid.rowOf(path[i]) - grid.rowOf(path[i - 1]));
+        int dc = std::abs(grid.colOf(path[i]) - grid.colOf(path[i - 1]));
+        int diagonal = std::min(dr, dc);
+        length += (std::max(dr, dc) - diagonal + diagonal * std::sqrt(2.0)) * grid.costs[path[i]];
+    }
+    return length;
+}
+
+void scoreScenario(ScenarioReport& report, double length, double optimalLength) {
+    if (length < 0) {
+        report.unchecked++;
+        return;
+    }
+    // Both lengths use the exact sqrt(2), so they only differ by the rounding of the
+    // file's lengths (8 decimals) and of the sums; a single wrong step is far above this.
+    const double tolerance = 1e-4;
+    double difference = length - optimalLength;
+    if (difference < -tolerance) {
+        report.shorter++;
+    } else if (difference > tolerance) {
+        report.longer++;
+    } else {
+        report.matched++;
+        report.worstError = std::max(report.worstError, std::fabs(difference));
+    }
+}
+
+bool scenarioFailed(const ScenarioReport& report) {
+    return report.shorter > 0 || report.longer > 0 || report.unsolved > 0;
+}
@@ -0,0 +1,150 @@
+// ===================================================================================
+// == FILE: src/MovingAI.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Loads the Moving AI benchmark maps (.map) and scenario lists (.scen)
+// and runs the scenarios through any of the pathfinding algorithms. A map file is
+// memory-mapped and turned into walls in a single pass over its bytes, so even the
+// 1024x1024 and larger maps load in a few milliseconds.
+//
+// The scenario lengths are octile distances (a diagonal costs sqrt(2)) on maps where
+// a diagonal may not cut a wall's corner, so the scenarios are run with corner
+// cutting turned off. An optimal search must then match every length: a path that
+// is shorter or longer than the file's optimum is a failure.
+//
+// ===================================================================================
+#ifndef MOVINGAI_H
+#define MOVINGAI_H
+
+#include "GridModel.h"
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+/**
+ * @brief One query of a .scen file. Coordinates are columns (x) and rows (y).
+ */
+struct MovingAIScenario {
+    int bucket = 0;
+    std::string map;    // The map file the query is on, as written in the file.
+    int mapWidth = 0, mapHeight = 0;
+    int startX = 0, startY = 0;
+    int goalX = 0, goalY = 0;
+    double optimalLength = 0.0;
+};
+
+/**
+ * @brief Loads a .map file into a grid, resizing it to the map.
+ *
+ * '.', 'G' and 'S' (ground, grass, swamp) are open; everything else (trees, water,
+ * out of bounds) becomes a wall. The walls are written straight into the model; the
+ * resize has already told every cached structure to rebuild, and a view tracking
+ * the model gets each wall in its change list.
+ * @param path The file to load.
+ * @param grid The grid to fill.
+ * @param error Set to a description of the problem when loading fails.
+ * @return True if the map was loaded.
+ */
+bool loadMovingAIMap(const std::string& path, GridModel& grid, std::string& error);
+
+/**
+ * @brief Loads the queries of a .scen file (version 1 format).
+ * @param path The file to load.
+ * @param scenarios Filled with the queries, in file order.
+ * @param error Set to a description of the problem when loading fails.
+ * @return True if the file was loaded.
+ */
+bool loadMovingAIScenarios(const std::string& path, std::vector<MovingAIScenario>& scenarios, std::string& error);
+
+/**
+ * @brief How a batch of scenarios went for one algorithm.
+ */
+struct ScenarioReport {
+    int queries = 0;
+    int matched = 0;     // Path length equal to the file's optimum (within rounding).
+    int shorter = 0;     // Cheaper than the optimum (the search broke the movement rules).
+    int longer = 0;      // More expensive than the optimum.
+    int unsolved = 0;    // No path found, though the file has one.
+    int unchecked = 0;   // Solved, but the algorithm's cost is not an optimal octile length.
+    int skipped = 0;     // Queries whose start or goal is off the grid or in a wall.
+    double totalSeconds = 0.0;
+    double worstSeconds = 0.0;
+    double worstError = 0.0;  // Largest |length - optimum| among matched queries.
+};
+
+/**
+ * @brief Puts the start and end of a query on the grid, clearing the last query's.
+ * @return False if either cell is off the grid or a wall.
+ */
+bool placeScenario(GridModel& grid, const MovingAIScenario& scenario);
+
+/**
+ * @brief The length of a path the way the scenario files measure it: a straight
+ * step is 1 and a diagonal exactly sqrt(2), each times the cost of the cell entered.
+ * @param path The cells of the path, from the start to the end.
+ */
+double octileLength(const GridModel& grid, const std::vector<int>& path);
+
+/**
+ * @brief Sorts a solved query's path length against the file's optimum into a report.
+ * @param length The path's octileLength(), or a negative number if the algorithm's
+ * paths are not checked.
+ */
+void scoreScenario(ScenarioReport& report, double length, double optimalLength);
+
+/**
+ * @brief Whether an algorithm got a checked query wrong: a path shorter or longer
+ * than the optimum, or none where the file has one.
+ */
+bool scenarioFailed(const ScenarioReport& report);
+
+/**
+ * @brief Runs every query of a scenario list with one algorithm.
+ *
+ * Only start() and the steps are timed, not moving the start and end cells. The
+ * state is reused for every query, as pressing Play again in the visualizer would.
+ * @param grid The map the scenarios are on.
+ * @param scenarios The queries to run.
+ * @param start A callable that seeds the state with the grid's start cell; its third
+ * argument says whether a diagonal may cut a wall's corner, which the scenarios never
+ * allow.
+ * @param step A callable that performs a single algorithm step.
+ * @param length A callable that returns the octileLength() of the path in the
+ * finished state, given the grid and the state, or a negative number if the
+ * algorithm's paths are not checked.
+ * @param isDiagonal Whether diagonal moves are allowed.
+ * @param state The state to run with (headless flags already set); it is left
+ * holding the last query's search.
+ */
+template <typename State, typename StartFn, typename StepFn, typename LengthFn>
+ScenarioReport runScenarios(GridModel& grid, const std::vector<MovingAIScenario>& scenarios, StartFn start,
+                            StepFn step, LengthFn length, bool isDiagonal, State& state) {
+    ScenarioReport report;
+    for (const MovingAIScenario& scenario : scenarios) {
+        grid.clearPath();
+        if (!placeScenario(grid, scenario)) {
+            report.skipped++;
+            continue;
+        }
+        auto begin = std::chrono::steady_clock::now();
+        start(grid, state, false);
+        while (!state.isComplete) step(grid, state, isDiagonal);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        report.queries++;
+        report.totalSeconds += seconds;
+        report.worstSeconds = std::max(report.worstSeconds, seconds);
+        if (state.noPathExists) {
+            report.unsolved++;
+        } else {
+            scoreScenario(report, length(grid, state), scenario.optimalLength);
+        }
+    }
+    grid.clearPath();
+    return report;
+}
+
+#endif // MOVINGAI_H
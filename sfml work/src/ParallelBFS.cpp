@@ -0,0 +1,227 @@
+// ===================================================================================
+// == FILE: src/ParallelBFS.cpp ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Implements the level-synchronous parallel BFS: the top-down and
+// bottom-up level kernels, the switch between them and the path read back from
+// the finished distance field.
+//
+// ===================================================================================
+#include "ParallelBFS.h"
+#include <algorithm>
+
+static const int DR[] = {-1, 1, 0, 0, -1, -1, 1, 1};
+static const int DC[] = {0, 0, -1, 1, -1, 1, -1, 1};
+
+// The slice [first, last) of 'count' items that a worker handles.
+static void sliceFor(int worker, int workers, std::size_t count, std::size_t& first, std::size_t& last) {
+    first = count * worker / workers;
+    last = count * (worker + 1) / workers;
+}
+
+// Top-down: each frontier cell claims its unreached neighbours for the next level.
+static void pushLevel(const GridModel& grid, ParallelBFSState& state, int worker, int workers, bool isDiagonal) {
+    std::vector<int>& out = state.localNext[worker];
+    out.clear();
+    std::size_t first, last;
+    sliceFor(worker, workers, state.frontier.size(), first, last);
+    int numDirections = isDiagonal ? 8 : 4;
+    int nextLevel = state.level + 1;
+    for (std::size_t k = first; k < last; ++k) {
+        int current = state.frontier[k];
+        int r = grid.rowOf(current);
+        int c = grid.colOf(current);
+        for (int i = 0; i < numDirections; ++i) {
+            int nr = r + DR[i];
+            int nc = c + DC[i];
+            if (!grid.isValid(nr, nc)) continue;
+            int neighbor = grid.index(nr, nc);
+            if (!state.open[neighbor] || state.dist[neighbor].load(std::memory_order_relaxed) >= 0) continue;
+            int unclaimed = -1;
+            if (state.dist[neighbor].compare_exchange_strong(unclaimed, nextLevel, std::memory_order_relaxed)) {
+                out.push_back(neighbor);
+            }
+        }
+    }
+}
+
+// Bottom-up: each unreached cell joins the next level if a neighbour is in the
+// frontier. Only its own entry is written, so no claims are needed.
+static void pullLevel(const GridModel& grid, ParallelBFSState& state, int worker, int workers, bool isDiagonal) {
+    std::vector<int>& out = state.localNext[worker];
+    std::vector<int>& kept = state.localKept[worker];
+    out.clear();
+    kept.clear();
+    std::size_t first, last;
+    sliceFor(worker, workers, state.unreached.size(), first, last);
+    int numDirections = isDiagonal ? 8 : 4;
+    for (std::size_t k = first; k < last; ++k) {
+        int cell = state.unreached[k];
+        int r = grid.rowOf(cell);
+        int c = grid.colOf(cell);
+        bool joins = false;
+        for (int i = 0; i < numDirections && !joins; ++i) {
+            int nr = r + DR[i];
+            int nc = c + DC[i];
+            joins = grid.isValid(nr, nc) &&
+                    state.dist[grid.index(nr, nc)].load(std::memory_order_relaxed) == state.level;
+        }
+        if (joins) {
+            state.dist[cell].store(state.level + 1, std::memory_order_relaxed);
+            out.push_back(cell);
+        } else {
+            kept.push_back(cell);
+        }
+    }
+}
+
+// Concatenates the workers' lists into one.
+static void gather(std::vector<std::vector<int>>& lists, std::vector<int>& into) {
+    into.clear();
+    for (std::vector<int>& list : lists) into.insert(into.end(), list.begin(), list.end());
+}
+
+// Walks back from the end through cells one level lower each time.
+static void tracePath(const GridModel& grid, ParallelBFSState& state, bool isDiagonal) {
+    int numDirections = isDiagonal ? 8 : 4;
+    state.path.clear();
+    int cell = grid.endIndex;
+    state.path.push_back(cell);
+    for (int level = state.dist[cell].load(); level > 0; --level) {
+        int r = grid.rowOf(cell);
+        int c = grid.colOf(cell);
+        for (int i = 0; i < numDirections; ++i) {
+            int nr = r + DR[i];
+            int nc = c + DC[i];
+            if (grid.isValid(nr, nc) && state.dist[grid.index(nr, nc)].load() == level - 1) {
+                cell = grid.index(nr, nc);
+                break;
+            }
+        }
+        state.path.push_back(cell);
+    }
+    std::reverse(state.path.begin(), state.path.end());
+}
+
+void parallelBFSStep(GridModel& grid, ParallelBFSState& state, bool isDiagonal) {
+    if (!state.isSearching || state.isComplete) return;
+
+    state.currentLine = 3; // while frontier is not empty
+    if (state.frontier.empty()) {
+        // The distance field is complete; read the path to the end off it.
+        state.isSearching = false;
+        state.isComplete = true;
+        if (grid.endIndex < 0 || state.dist[grid.endIndex].load() < 0) {
+            state.noPathExists = true;
+            state.currentLine = 12; // return PathNotFound
+            return;
+        }
+        tracePath(grid, state, isDiagonal);
+        for (int cell : state.path) state.pathCost += grid.costs[cell];
+        if (state.paintCells) setLivePath(grid, state.livePath, state.path);
+        state.currentLine = 14; // return PathFound
+        return;
+    }
+
+    // 1. Pick the direction. Pulling costs a pass over the unreached cells, so it pays
+    //    once they are few compared to the frontier; the two thresholds keep the
+    //    search from flipping back and forth.
+    int remaining = state.openCells - state.nodesVisited;
+    int frontierSize = static_cast<int>(state.frontier.size());
+    if (!state.bottomUp && remaining < static_cast<long long>(state.alpha) * frontierSize) {
+        state.bottomUp = true;
+        state.unreached.clear();
+        for (int i = 0; i < grid.size(); ++i) {
+            if (state.open[i] && state.dist[i].load(std::memory_order_relaxed) < 0) state.unreached.push_back(i);
+        }
+    } else if (state.bottomUp && remaining > static_cast<long long>(state.beta) * frontierSize) {
+        state.bottomUp = false;
+    }
+
+    // 2. Every worker expands its slice of the level. Waking the pool costs more than
+    //    a small level does, so those stay on this thread (as one slice).
+    std::size_t work = state.bottomUp ? state.unreached.size() : state.frontier.size();
+    bool inParallel = work >= static_cast<std::size_t>(state.minParallelWork);
+    int workers = inParallel ? state.pool->size() : 1;
+    if (!inParallel) {
+        for (std::size_t w = 1; w < state.localNext.size(); ++w) state.localNext[w].clear();
+        for (std::size_t w = 1; w < state.localKept.size(); ++w) state.localKept[w].clear();
+    }
+    if (state.bottomUp) {
+        state.currentLine = 6; // pull: for each unreached cell in parallel
+        auto job = [&](int worker) { pullLevel(grid, state, worker, workers, isDiagonal); };
+        if (inParallel) state.pool->run(job); else job(0);
+        gather(state.localKept, state.unreached);
+        state.bottomUpLevels++;
+    } else {
+        state.currentLine = 5; // push: frontier cells claim neighbours in parallel
+        auto job = [&](int worker) { pushLevel(grid, state, worker, workers, isDiagonal); };
+        if (inParallel) state.pool->run(job); else job(0);
+        state.topDownLevels++;
+    }
+    if (inParallel) state.parallelLevels++;
+
+    // 3. The new level becomes the frontier.
+    state.currentLine = 9; // frontier = new cells, level += 1
+    gather(state.localNext, state.frontier);
+    if (!state.frontier.empty()) state.level++;
+    state.nodesVisited += static_cast<int>(state.frontier.size());
+    if (state.paintCells) {
+        for (int cell : state.frontier) {
+            if (cell != grid.endIndex) grid.setType(cell, NodeType::Visited);
+        }
+    }
+}
+
+void startParallelBFS(GridModel& grid, ParallelBFSState& state) {
+    resetParallelBFS(state);
+    int workers = state.threads > 0 ? state.threads : WorkerPool::hardwareWorkers();
+    if (!state.pool || state.pool->size() != workers) {
+        state.pool.reset();
+        state.pool.reset(new WorkerPool(workers));
+        state.localNext.assign(workers, std::vector<int>());
+        state.localKept.assign(workers, std::vector<int>());
+    }
+
+    if (static_cast<int>(state.dist.size()) != grid.size()) {
+        state.dist = std::vector<std::atomic<int>>(grid.size());
+    }
+    state.open.resize(grid.size());
+    std::vector<int> openPerWorker(workers, 0);
+    state.pool->run([&](int worker) {
+        std::size_t first, last;
+        sliceFor(worker, workers, grid.size(), first, last);
+        for (std::size_t i = first; i < last; ++i) {
+            state.dist[i].store(-1, std::memory_order_relaxed);
+            state.open[i] = grid.types[i] != NodeType::Wall && grid.costs[i] == 1;
+            openPerWorker[worker] += state.open[i];
+        }
+    });
+    state.openCells = 0;
+    for (int count : openPerWorker) state.openCells += count;
+
+    state.dist[grid.startIndex].store(0);
+    state.frontier.assign(1, grid.startIndex);
+    state.nodesVisited = 1;
+    state.isSearching = true;
+}
+
+void resetParallelBFS(ParallelBFSState& state) {
+    state.isSearching = false;
+    state.isComplete = false;
+    state.noPathExists = false;
+    resetLivePath(state.livePath);
+    state.frontier.clear();
+    state.unreached.clear();
+    state.bottomUp = false;
+    state.currentLine = 0;
+    state.level = 0;
+    state.nodesVisited = 0;
+    state.pathCost = 0;
+    state.topDownLevels = 0;
+    state.bottomUpLevels = 0;
+    state.parallelLevels = 0;
+    state.path.clear();
+}
@@ -0,0 +1,95 @@
+// ===================================================================================
+// == FILE: src/ParallelBFS.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Header file for the parallel, direction-optimizing Breadth-First
+// Search. It computes the full distance field of a map one level at a time, with
+// every level split across a pool of worker threads. While the frontier is small
+// the workers push it outwards (top-down: each frontier cell claims its unreached
+// neighbours); once the cells still unreached are few compared to the frontier,
+// they pull instead (bottom-up: each unreached cell looks for a neighbour in the
+// frontier), which needs no atomic claims and stops at the first hit.
+//
+// ===================================================================================
+#ifndef PARALLELBFS_H
+#define PARALLELBFS_H
+
+#include "GridModel.h"
+#include "LivePath.h"
+#include "WorkerPool.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Holds all state information for a parallel BFS in progress.
+ */
+struct ParallelBFSState {
+    // --- Tuning ---
+    int threads = 0;  // Workers for the next run (0 = one per core).
+    int alpha = 2;    // Switch to bottom-up once unreached open cells < alpha * frontier...
+    int beta = 8;     // ...and back to top-down once they are > beta * frontier.
+    int minParallelWork = 1024; // Levels with less work than this run on the calling thread alone.
+
+    std::unique_ptr<WorkerPool> pool; // Rebuilt only when the worker count changes.
+
+    // dist[i] is the level at which cell i was reached, or -1. Top-down workers race
+    // to claim a cell, so the entries are atomic; each level's writes are published to
+    // the next level by the pool's hand-off.
+    std::vector<std::atomic<int>> dist;
+    std::vector<std::uint8_t> open;     // 1 for cells BFS may enter: not walls and (as in bfsStep) not weights.
+    int openCells = 0;
+
+    std::vector<int> frontier;          // The cells of the current level.
+    std::vector<int> unreached;         // Bottom-up only: open cells not reached yet.
+    std::vector<std::vector<int>> localNext; // Per worker: the cells it added to the next level.
+    std::vector<std::vector<int>> localKept; // Per worker (bottom-up): cells still unreached.
+    bool bottomUp = false;
+
+    // --- State Flags ---
+    bool isSearching = false;
+    bool isComplete = false;
+    bool noPathExists = false;
+
+    // --- Visualization & Stats ---
+    bool paintCells = true;   // Headless runs turn this off to skip painting each level.
+    int currentLine = 0;
+    int level = 0;            // The level of the frontier (the start is level 0).
+    int nodesVisited = 0;     // Cells reached.
+    int pathCost = 0;
+    int topDownLevels = 0;
+    int bottomUpLevels = 0;
+    int parallelLevels = 0;   // Levels large enough to be split across the workers.
+    std::vector<int> path;    // Start to end, if the end was reached.
+    LivePath livePath;        // The yellow path painted once the field is complete.
+};
+
+/**
+ * @brief Expands the next BFS level on all workers.
+ *
+ * The search runs until every reachable cell has its distance, then draws the
+ * path to the end cell if it was reached.
+ * @param grid The pathfinding grid model (passed by reference).
+ * @param state The current state of the search (passed by reference).
+ * @param isDiagonal A boolean flag to enable/disable 8-directional movement.
+ */
+void parallelBFSStep(GridModel& grid, ParallelBFSState& state, bool isDiagonal);
+
+/**
+ * @brief Resets the state, (re)starts the worker pool if the thread count changed
+ * and seeds the start cell. Clearing the distance field is split across the workers.
+ * @param grid The pathfinding grid model; its startIndex must be set.
+ * @param state The state object to initialize (passed by reference).
+ */
+void startParallelBFS(GridModel& grid, ParallelBFSState& state);
+
+/**
+ * @brief Resets the state to its default values for a new search.
+ * @param state The state object to reset (passed by reference).
+ */
+void resetParallelBFS(ParallelBFSState& state);
+
+#endif // PARALLELBFS_H
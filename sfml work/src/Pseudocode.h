@@ -168,12 +168,12 @@ public:
             "    return PathFound",
             "  end if",
             "  for each neighbor of current",
-            "   tentative_gCost = gCost[current] + 1",
+            "   tentative_gCost = gCost[current] + cost",
             "   if tentative_gCost < gCost[neighbor]",
             "    parent[neighbor] = current",
             "    gCost[neighbor] = tentative_gCost",
             "    fCost[neighbor] = gCost + heuristic",
-            "    openSet.add(neighbor)",
+            "    openSet.addOrDecrease(neighbor)",
             "   end if",
             "  end for",
             " end while",
@@ -198,6 +198,212 @@ public:
             " end while",
             "end procedure"
         };
+
+        pseudocodes["JPS"] = {
+            "procedure JPS(start, goal)",
+            " openSet.add(start)",
+            " while openSet is not empty",
+            "  current = node in openSet with lowest fCost",
+            "  if current == goal",
+            "    return PathFound",
+            "  end if",
+            "  for each direction in pruned(current, parent)",
+            "   jumpPoint = jump(current, direction)",
+            "   g = gCost[current] + dist(current, jumpPoint)",
+            "   if jumpPoint exists and g < gCost[jumpPoint]",
+            "    parent[jumpPoint] = current",
+            "    gCost[jumpPoint] = g",
+            "    openSet.add(jumpPoint)",
+            "   end if",
+            "  end for",
+            " end while",
+            " return PathNotFound",
+            "end procedure"
+        };
+
+        pseudocodes["JPS+"] = {
+            "procedure JPS+(start, goal)",
+            " jumpDist = precompute(walls)  // once per map",
+            " openSet.add(start)",
+            " while openSet is not empty",
+            "  current = node in openSet with lowest fCost",
+            "  if current == goal: return PathFound",
+            "  for each direction in pruned(current, parent)",
+            "   d = jumpDist[current][direction]",
+            "   if goal is within d moves in this direction",
+            "    next = goal (or the cell level with it)",
+            "   else if d > 0",
+            "    next = current + d * direction",
+            "   end if",
+            "   if next exists and g < gCost[next]",
+            "    parent[next] = current, openSet.add(next)",
+            "  end for",
+            " end while",
+            " return PathNotFound",
+            "end procedure"
+        };
+
+        pseudocodes["Bidirectional BFS"] = {
+            "procedure BiBFS(start, goal)",
+            " Qf.enqueue(start), Qb.enqueue(goal)",
+            " best = infinity",
+            " while Qf and Qb are not empty",
+            "  if dist(Qf.front) + dist(Qb.front) >= best",
+            "    return PathFound",
+            "  Q = the side with the smaller queue",
+            "  current = Q.dequeue()",
+            "  for each neighbor of current",
+            "   if neighbor is not visited by this side",
+            "    label neighbor, Q.enqueue(neighbor)",
+            "   end if",
+            "   if neighbor is visited by the other side",
+            "    best = min(best, d(current) + 1 + d'(neighbor))",
+            "   end if",
+            "  end for",
+            " end while",
+            " return best found ? PathFound : PathNotFound",
+            "end procedure"
+        };
+
+        pseudocodes["Bidirectional A*"] = {
+            "procedure BiAStar(start, goal)",
+            " openF.add(start), openB.add(goal), best = inf",
+            " while openF and openB are not empty",
+            "  if minKey(openF) + minKey(openB) >= 2 * best",
+            "    return PathFound",
+            "  current = lowest key in the smaller open set",
+            "  for each neighbor of current",
+            "   g = gCost[current] + cost(move)",
+            "   if g < gCost[neighbor]",
+            "    parent[neighbor] = current, gCost = g",
+            "    key = 2g + h(to other end) - h(to own end)",
+            "    open.add(neighbor)",
+            "   end if",
+            "   if neighbor is reached by the other side",
+            "    best = min(best, g + gCost'(neighbor))",
+            "  end for",
+            " end while",
+            " return best found ? PathFound : PathNotFound",
+            "end procedure"
+        };
+
+        pseudocodes["LPA*"] = {
+            "procedure LPA*(start, goal)",
+            " rhs[start] = 0, queue.add(start)",
+            " loop",
+            "  while topKey < key(goal) or g[goal] != rhs",
+            "   u = queue.pop()",
+            "   if g[u] > rhs[u]",
+            "    g[u] = rhs[u]",
+            "    for each successor s: updateVertex(s)",
+            "   else",
+            "    g[u] = infinity",
+            "    updateVertex(u) and each successor s",
+            "  end while",
+            "  return g[goal] finite ? PathFound : NotFound",
+            "  wait for wall / weight edits",
+            "  for each edited cell c",
+            "   updateVertex(c) and each neighbor of c",
+            " end loop",
+            "updateVertex(u): rhs[u] = min g[p] + cost(u)",
+            "end procedure"
+        };
+
+        pseudocodes["HPA*"] = {
+            "procedure HPA*(start, goal)",
+            " rebuild clusters whose cells changed",
+            " link start and goal to their cluster",
+            " open.add(start)",
+            " while open is not empty",
+            "  u = node in open with lowest fCost",
+            "  if u == goal: break",
+            "  for each abstract edge (u, v, cost)",
+            "   if g[u] + cost < g[v]",
+            "    parent[v] = u, open.add(v)",
+            " end while",
+            " if goal not reached: return PathNotFound",
+            " for each abstract edge (a, b) on the path",
+            "  if a and b share a cluster",
+            "   path += A*(a, b) inside the cluster",
+            "  else",
+            "   path += b",
+            " return PathFound",
+            "end procedure"
+        };
+
+        pseudocodes["Bitboard BFS"] = {
+            "procedure BitboardBFS(grid,start,end)",
+            " pack open cells 64 to a word",
+            " frontier = {start}, visited = {start}",
+            " level = 0",
+            " while frontier is not empty do",
+            "  next = grow(frontier) & open & ~visited",
+            "  visited |= next, level += 1",
+            "  frontier = next",
+            "  if end is in frontier then",
+            "   walk back through level - 1 cells",
+            "   return PathFound",
+            "  end if",
+            " end while",
+            " return PathNotFound",
+            "end procedure"
+        };
+
+        pseudocodes["Parallel BFS"] = {
+            "procedure ParallelBFS(grid,start,end)",
+            " dist[all cells] = -1 (split across threads)",
+            " dist[start] = 0, frontier = {start}, level = 0",
+            " while frontier is not empty do",
+            "  pull if few cells are unreached, else push",
+            "  push: frontier cells claim neighbours in parallel",
+            "  pull: for each unreached cell in parallel",
+            "   if a neighbour has dist = level then join",
+            "  dist[new cells] = level + 1",
+            "  frontier = new cells, level += 1",
+            " end while",
+            " if dist[end] < 0 then",
+            "  return PathNotFound",
+            " walk back from end through dist - 1 cells",
+            " return PathFound",
+            "end procedure"
+        };
+
+        pseudocodes["Delta-Stepping"] = {
+            "procedure DeltaStepping(grid,start,end,delta)",
+            " dist[all cells] = inf, dist[start] = 0",
+            " B[0] = {start}  // B[i]: cost in [i*delta, (i+1)*delta)",
+            " while any bucket is not empty do",
+            "  i = lowest non-empty bucket, S = {}",
+            "  while B[i] is not empty do",
+            "   R = cells taken out of B[i], S += R",
+            "   relax light moves out of R in parallel",
+            "  end while",
+            "  relax heavy moves out of S in parallel",
+            "  relax(v, d): if d < dist[v], dist[v] = d, v -> B[d/delta]",
+            "  if end is in S then",
+            "   walk back through cells with dist + move = dist",
+            "   return PathFound",
+            "  end if",
+            " end while",
+            " return PathNotFound",
+            "end procedure"
+        };
+
+        pseudocodes["Flow Field"] = {
+            "procedure FlowField(grid,goal)",
+            " cost[all cells] = inf, cost[goal] = 0",
+            " Q = {goal}",
+            " while Q is not empty do",
+            "  u = cell in Q with min cost",
+            "  for each neighbour v of u do",
+            "   c = cost[u] + step(v,u) * weight(u)",
+            "   if c < cost[v] then",
+            "    cost[v] = c, dir[v] = towards u, v -> Q",
+            "  end for",
+            " end while",
+            " every agent at x moves to x + dir[x]",
+            "end procedure"
+        };
     }
 };
 
@@ -0,0 +1,73 @@
+// ===================================================================================
+// == FILE: src/ResultCache.cpp ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Implements the LRU cache of finished searches and the capture and
+// replay of a search's markers.
+//
+// ===================================================================================
+#include "ResultCache.h"
+#include <functional>
+
+void captureSearch(const GridModel& grid, CachedSearch& result) {
+    result.order.clear();
+    result.marks.clear();
+    result.order.reserve(grid.searchCells.size());
+    result.marks.reserve(grid.searchCells.size());
+    for (int i : grid.searchCells) {
+        if (!isSearchMarker(grid.types[i])) continue;  // Overwritten since, e.g. by an edit.
+        result.order.push_back(i);
+        result.marks.push_back(grid.types[i]);
+    }
+}
+
+void replaySearch(GridModel& grid, const CachedSearch& result) {
+    for (std::size_t k = 0; k < result.order.size(); ++k) grid.setType(result.order[k], result.marks[k]);
+}
+
+std::size_t ResultCache::KeyHash::operator()(const SearchKey& key) const {
+    // Boost-style combine of the fields' hashes.
+    std::size_t hash = std::hash<std::string>()(key.algorithm);
+    auto mix = [&hash](std::size_t value) { hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2); };
+    mix(key.isDiagonal);
+    mix(std::hash<int>()(key.start));
+    mix(std::hash<int>()(key.end));
+    mix(std::hash<std::uint64_t>()(key.version));
+    return hash;
+}
+
+ResultCache::ResultCache(std::size_t capacity) : maxEntries(capacity > 0 ? capacity : 1) {}
+
+const CachedSearch* ResultCache::find(const SearchKey& key) {
+    auto found = lookup.find(key);
+    if (found == lookup.end()) {
+        misses++;
+        return nullptr;
+    }
+    hits++;
+    entries.splice(entries.begin(), entries, found->second);
+    return &found->second->second;
+}
+
+void ResultCache::store(const SearchKey& key, CachedSearch result) {
+    auto found = lookup.find(key);
+    if (found != lookup.end()) {
+        found->second->second = std::move(result);
+        entries.splice(entries.begin(), entries, found->second);
+        return;
+    }
+    if (entries.size() >= maxEntries) {
+        lookup.erase(entries.back().first);
+        entries.pop_back();
+        evictions++;
+    }
+    entries.emplace_front(key, std::move(result));
+    lookup[key] = entries.begin();
+}
+
+void ResultCache::clear() {
+    entries.clear();
+    lookup.clear();
+}
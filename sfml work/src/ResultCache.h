@@ -0,0 +1,120 @@
+// ===================================================================================
+// == FILE: src/ResultCache.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Defines ResultCache, a small least-recently-used cache of finished
+// pathfinding searches. The same start/end pair tends to be solved again and again
+// (after clearing the path, toggling a setting or switching algorithms), and every
+// reset throws the search away. A cached search is keyed by the algorithm, the diagonal setting,
+// the start and end cells and the grid's content version, so it is only ever
+// replayed onto the exact map it was found on.
+//
+// ===================================================================================
+#ifndef RESULTCACHE_H
+#define RESULTCACHE_H
+
+#include "GridModel.h"
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Identifies one search: which algorithm ran, how, and on which map.
+ */
+struct SearchKey {
+    std::string algorithm;    // The algorithm and any setting that changes its result.
+    bool isDiagonal = false;
+    int start = -1, end = -1;
+    std::uint64_t version = 0;  // GridModel::contentVersion() when the search started.
+
+    bool operator==(const SearchKey& other) const {
+        return algorithm == other.algorithm && isDiagonal == other.isDiagonal && start == other.start &&
+               end == other.end && version == other.version;
+    }
+};
+
+/**
+ * @brief What a finished search left behind: its markers, in the order it painted
+ * them, and its counters.
+ *
+ * The path is the cells whose marker is Path. A search run with painting turned
+ * off leaves no markers, only the counters.
+ */
+struct CachedSearch {
+    std::vector<int> order;       // Cells the search painted, in the order it first painted them.
+    std::vector<NodeType> marks;  // The marker each of those cells ended with.
+    int nodesVisited = 0;
+    int pathCost = 0;
+    bool noPathExists = false;
+    std::string costText;   // The cost as the caller displayed it (units vary by algorithm).
+    std::string extraText;  // Any further statistics the caller wants shown again on a hit.
+};
+
+/**
+ * @brief Copies the search markers currently on the grid into a cached search.
+ * @param grid The grid the search has just finished on.
+ * @param result Receives the markers; its counters are left for the caller to fill.
+ */
+void captureSearch(const GridModel& grid, CachedSearch& result);
+
+/**
+ * @brief Paints a cached search's markers back onto the grid in the order they
+ * were first painted. The grid's old path should be cleared first.
+ * @param grid The grid to paint (the one the search was cached from).
+ * @param result The search to replay.
+ */
+void replaySearch(GridModel& grid, const CachedSearch& result);
+
+/**
+ * @brief A least-recently-used cache of finished searches.
+ *
+ * Lookups and insertions are O(1): the entries sit in a list kept in order of use
+ * and a hash map points into it. Entries for an old version of the map are never
+ * hit again and simply age out.
+ */
+class ResultCache {
+public:
+    /**
+     * @param capacity The most searches kept before the least recently used one is dropped.
+     */
+    explicit ResultCache(std::size_t capacity);
+
+    /**
+     * @brief Looks a search up, marking it as the most recently used.
+     * @return The cached search, or nullptr. The pointer stays valid until the next
+     * store() or clear().
+     */
+    const CachedSearch* find(const SearchKey& key);
+
+    /**
+     * @brief Adds a finished search (or replaces the one under the same key),
+     * dropping the least recently used entry if the cache is full.
+     */
+    void store(const SearchKey& key, CachedSearch result);
+
+    void clear();
+    std::size_t size() const { return entries.size(); }
+    std::size_t capacity() const { return maxEntries; }
+
+    long long hits = 0;
+    long long misses = 0;
+    long long evictions = 0;
+
+private:
+    struct KeyHash {
+        std::size_t operator()(const SearchKey& key) const;
+    };
+    using Entry = std::pair<SearchKey, CachedSearch>;
+
+    std::list<Entry> entries;  // Most recently used first.
+    std::unordered_map<SearchKey, std::list<Entry>::iterator, KeyHash> lookup;
+    std::size_t maxEntries;
+};
+
+#endif // RESULTCACHE_H
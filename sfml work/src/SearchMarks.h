@@ -0,0 +1,58 @@
+// ===================================================================================
+// == FILE: src/SearchMarks.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Defines SearchMarks, the per-cell "open" and "closed" markers shared
+// by the pathfinding algorithms. Every marker is tagged with the generation of the
+// run that wrote it, so starting a new search only bumps a counter instead of
+// clearing an array the size of the grid.
+//
+// ===================================================================================
+#ifndef SEARCHMARKS_H
+#define SEARCHMARKS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Generation-stamped open/closed flags for every cell of a grid.
+ *
+ * Each run owns two stamp values: 'generation' (the cell has been reached and is
+ * open) and 'generation + 1' (the cell has been closed). Stamps written by older
+ * runs are smaller than both, so they read as "unseen" without ever being erased.
+ * Per-cell arrays that an algorithm keeps next to the marks (parents, costs) are
+ * only meaningful for cells that are seen() in the current run.
+ */
+class SearchMarks {
+public:
+    /**
+     * @brief Starts a new run. O(1), except when the grid size changes or the
+     * generation counter wraps around (about once every two billion runs).
+     * @param cellCount The number of cells in the grid being searched.
+     */
+    void begin(int cellCount) {
+        if (static_cast<int>(stamps.size()) != cellCount) {
+            stamps.assign(cellCount, 0);
+            generation = 0;
+        }
+        if (generation >= UINT32_MAX - 2) {
+            std::fill(stamps.begin(), stamps.end(), 0);
+            generation = 0;
+        }
+        generation += 2;
+    }
+
+    bool seen(int index) const { return stamps[index] >= generation; }
+    bool closed(int index) const { return stamps[index] == generation + 1; }
+    void open(int index) { stamps[index] = generation; }
+    void close(int index) { stamps[index] = generation + 1; }
+
+private:
+    std::vector<std::uint32_t> stamps;
+    std::uint32_t generation = 0;
+};
+
+#endif // SEARCHMARKS_H
@@ -0,0 +1,69 @@
+// ===================================================================================
+// == FILE: src/WorkerPool.cpp ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Implements the parked worker threads behind WorkerPool.
+//
+// ===================================================================================
+#include "WorkerPool.h"
+#include <algorithm>
+
+int WorkerPool::hardwareWorkers() {
+    return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+WorkerPool::WorkerPool(int workers) {
+    if (workers <= 0) workers = hardwareWorkers();
+    for (int worker = 1; worker < workers; ++worker) {
+        threads.emplace_back(&WorkerPool::workerLoop, this, worker);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& thread : threads) thread.join();
+}
+
+void WorkerPool::run(const std::function<void(int)>& job) {
+    if (threads.empty()) {
+        job(0);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        current = &job;
+        running = static_cast<int>(threads.size());
+        jobNumber++;
+    }
+    wake.notify_all();
+    job(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this] { return running == 0; });
+    current = nullptr;
+}
+
+void WorkerPool::workerLoop(int worker) {
+    unsigned long long done = 0;
+    while (true) {
+        const std::function<void(int)>* job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stopping || jobNumber != done; });
+            if (stopping) return;
+            done = jobNumber;
+            job = current;
+        }
+        (*job)(worker);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--running == 0) finished.notify_one();
+        }
+    }
+}
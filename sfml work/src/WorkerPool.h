@@ -0,0 +1,66 @@
+// ===================================================================================
+// == FILE: src/WorkerPool.h ==
+// ===================================================================================
+//
+// AUTHOR: Arpit Jatav
+//
+// DESCRIPTION: Defines WorkerPool, a small fixed set of threads for the parallel
+// searches. A level-synchronous search hands the same job to every worker once per
+// level and waits for all of them, so the pool keeps its threads parked between
+// jobs instead of starting new ones thousands of times per search.
+//
+// ===================================================================================
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Runs one job on a fixed number of workers and waits for it to finish.
+ *
+ * The thread that calls run() is worker 0, so a pool of one worker starts no
+ * threads and runs the job inline.
+ */
+class WorkerPool {
+public:
+    /**
+     * @brief Starts the pool.
+     * @param workers The number of workers, the calling thread included (0 = one per core).
+     */
+    explicit WorkerPool(int workers = 0);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    int size() const { return static_cast<int>(threads.size()) + 1; }
+
+    /**
+     * @brief Calls job(worker) once for every worker 0 ... size() - 1, in parallel,
+     * and returns when all calls have returned.
+     */
+    void run(const std::function<void(int)>& job);
+
+    /**
+     * @brief The number of workers a count of 0 stands for: one per core.
+     */
+    static int hardwareWorkers();
+
+private:
+    void workerLoop(int worker);
+
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wake;     // Signals a new job (or shutdown) to the threads.
+    std::condition_variable finished; // Signals run() that the last thread is done.
+    const std::function<void(int)>* current = nullptr;
+    unsigned long long jobNumber = 0; // Bumped for every job, so a thread runs each one once.
+    int running = 0;                  // Threads still busy with the current job.
+    bool stopping = false;
+};
+
+#endif // WORKERPOOL_H